@@ -0,0 +1,145 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include "lhef/lhef.h"
+
+// The analysis helpers as they were when `Event::particleEntries()` and
+// `Event::particles()` returned copies. Every call copies the event.
+namespace copying {
+lhef::Particles particles(const lhef::Event &lhe) {
+    const lhef::EventEntry entry{lhe.particleEntries()};
+    return lhef::Particles(entry.begin(), entry.end());
+}
+
+lhef::Particles finalStates(const lhef::Event &lhe) {
+    const lhef::Particles ps{particles(lhe)};
+    return lhef::finalStates(ps);
+}
+
+lhef::Particles particlesOf(const lhef::ParticleID &pid,
+                            const lhef::Event &lhe) {
+    const lhef::Particles ps{particles(lhe)};
+    return lhef::selectByID(pid, ps);
+}
+
+lhef::ParticleLines particleLinesOf(const lhef::ParticleID &pid,
+                                    const lhef::Event &lhe) {
+    lhef::ParticleLines line;
+    const lhef::EventEntry entry{lhe.particleEntries()};
+    for (int l = 1; l <= static_cast<int>(entry.size()); ++l) {
+        if (entry.at(l).is(pid)) { line.push_back(l); }
+    }
+    return line;
+}
+
+lhef::Particle mother(const lhef::Particle &p, const lhef::Event &lhe) {
+    const lhef::EventEntry entry{lhe.particleEntries()};
+    const int mo_line = p.mother().first;
+    return entry.count(mo_line) ? entry.at(mo_line) : entry.at(1);
+}
+
+lhef::Particle ancestor(const lhef::Particle &p, const lhef::Event &lhe) {
+    const auto m = copying::mother(p, lhe);
+    return m.mother().first == 1 ? m : copying::ancestor(m, lhe);
+}
+
+bool isInMotherLines(int pline, const lhef::Particle &p,
+                     const lhef::Event &lhe) {
+    const int mo_line = p.mother().first;
+    if (mo_line == 1) { return false; }
+    if (mo_line == pline) { return true; }
+    return isInMotherLines(pline, copying::mother(p, lhe), lhe);
+}
+
+lhef::Particles finalDaughters(int pline, const lhef::Event &lhe) {
+    lhef::Particles finalstates = copying::finalStates(lhe);
+    auto pos = std::remove_if(finalstates.begin(), finalstates.end(),
+                              [pline, &lhe](const lhef::Particle &p) {
+                                  return !isInMotherLines(pline, p, lhe);
+                              });
+    finalstates.erase(pos, finalstates.end());
+    return finalstates;
+}
+}  // namespace copying
+
+namespace views {
+using lhef::ancestor;
+using lhef::finalDaughters;
+using lhef::finalStates;
+using lhef::particleLinesOf;
+using lhef::particlesOf;
+}  // namespace views
+
+// A typical top-quark analysis: leptons and their ancestors, and the final
+// daughters of every top quark.
+#define ANALYSIS(NS)                                                        \
+    double analysis_##NS(const std::vector<lhef::Event> &events) {          \
+        double sum = 0.0;                                                   \
+        for (const auto &lhe : events) {                                    \
+            sum += NS::finalStates(lhe).size();                             \
+            for (const auto &lep : NS::particlesOf(lhef::LeptonIso, lhe)) { \
+                sum += NS::ancestor(lep, lhe).pt();                         \
+            }                                                               \
+            for (const auto l : NS::particleLinesOf(lhef::Top, lhe)) {      \
+                sum += NS::finalDaughters(l, lhe).size();                   \
+            }                                                               \
+        }                                                                   \
+        return sum;                                                         \
+    }
+
+ANALYSIS(copying)
+ANALYSIS(views)
+
+template <typename Analysis>
+double timePerEvent(Analysis analysis, const std::vector<lhef::Event> &events,
+                    double *result) {
+    const int repeat = 10;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; ++i) { *result = analysis(events); }
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (repeat * events.size());
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: bench_analysis_lhef input\n"
+                  << "    - input: ttbar events in "
+                  << "Les Houches Event File format\n";
+        return 1;
+    }
+
+    std::ifstream filename(argv[1]);
+    if (!filename) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+
+    std::vector<lhef::Event> events;
+    for (lhef::Event lhe; lhef::parseEvent(&filename, &lhe);) {
+        events.push_back(lhe);
+    }
+    if (events.empty()) {
+        std::cerr << "-- No events in \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    std::cout << "-- " << events.size() << " events read.\n";
+
+    double result_copying, result_views;
+    const double t_copying =
+        timePerEvent(analysis_copying, events, &result_copying);
+    const double t_views = timePerEvent(analysis_views, events, &result_views);
+    std::cout << "-- copying accessors: " << t_copying << " ns/event\n"
+              << "-- views            : " << t_views << " ns/event\n"
+              << "-- speedup: " << t_copying / t_views << '\n';
+
+    if (result_copying != result_views) {
+        std::cerr << "-- The two analyses disagree.\n";
+        return 1;
+    }
+}
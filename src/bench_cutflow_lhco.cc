@@ -0,0 +1,200 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "lhco/lhco.h"
+
+using colevent::Eta;
+using colevent::Pt;
+
+// The counting helpers as they were when the accessors of `lhco::Event`
+// returned the collections by value. Every call copies a collection.
+namespace copying {
+// The collection is taken by value, which is the one copy of the old API.
+template <typename T>
+int numOfParticles(const Pt &pt, const Eta &eta, std::vector<T> ps) {
+    int count = 0;
+    for (const auto &p : ps) {
+        if (p.pt() > pt.value && std::abs(p.eta()) < eta.value) { ++count; }
+    }
+    return count;
+}
+
+template <typename T>
+std::vector<T> copy(const std::vector<T> &ps) {
+    return ps;
+}
+
+int numElectron(const lhco::Event &ev) {
+    return copy(ev.electrons()).size();
+}
+
+int numMuon(const lhco::Event &ev) { return copy(ev.muons()).size(); }
+
+int numMuon(const Pt &pt, const Eta &eta, const lhco::Event &ev) {
+    return numOfParticles(pt, eta, ev.muons());
+}
+
+int numNormalJet(const Pt &pt, const Eta &eta, const lhco::Event &ev) {
+    return numOfParticles(pt, eta, ev.jets());
+}
+
+int numBjet(const Pt &pt, const Eta &eta, const lhco::Event &ev) {
+    return numOfParticles(pt, eta, ev.bjets());
+}
+
+int numAllJet(const Pt &pt, const Eta &eta, const lhco::Event &ev) {
+    return copying::numNormalJet(pt, eta, ev) + copying::numBjet(pt, eta, ev);
+}
+
+int numLeptonIso(const lhco::Event &ev) {
+    return copying::numElectron(ev) + copying::numMuon(ev);
+}
+
+double missingET(const lhco::Event &ev) { return lhco::Met(ev.met()).pt(); }
+}  // namespace copying
+
+// The number of events passing each step of a typical top-pair selection.
+struct CutFlow {
+    std::vector<long> passed = std::vector<long>(5, 0);
+    double seconds = 0.0;
+};
+
+template <typename Select>
+CutFlow timeCutFlow(const std::vector<lhco::Event> &events, int repeat,
+                    Select select) {
+    CutFlow cf;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; ++i) {
+        for (const auto &ev : events) { select(ev, &cf.passed); }
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    cf.seconds = elapsed.count();
+    return cf;
+}
+
+void report(const std::string &name, const CutFlow &cf, long num_eve) {
+    std::cout << "-- " << name << ": " << cf.seconds * 1e9 / num_eve
+              << " ns/event, passed:";
+    for (const auto n : cf.passed) { std::cout << ' ' << n; }
+    std::cout << '\n';
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: bench_cutflow_lhco input\n"
+                  << "    - input: Input file in LHC Olympics format\n";
+        return 1;
+    }
+
+    std::ifstream filename(argv[1]);
+    if (!filename) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    std::vector<lhco::Event> events;
+    auto start = std::chrono::steady_clock::now();
+    for (auto ev = lhco::parseEvent(&filename); !ev.done();
+         ev = lhco::parseEvent(&filename)) {
+        events.push_back(ev);
+    }
+    const std::chrono::duration<double> parse_events =
+        std::chrono::steady_clock::now() - start;
+
+    const Pt jet_pt(30.0), lep_pt(20.0);
+    const Eta jet_eta(2.5), lep_eta(2.4);
+    const int repeat = 50;
+    const long num_eve = repeat * static_cast<long>(events.size());
+
+    const CutFlow before = timeCutFlow(
+        events, repeat,
+        [&](const lhco::Event &ev, std::vector<long> *passed) {
+            ++(*passed)[0];
+            if (copying::numLeptonIso(ev) < 1) { return; }
+            ++(*passed)[1];
+            if (copying::numMuon(lep_pt, lep_eta, ev) > 1) { return; }
+            ++(*passed)[2];
+            if (copying::numAllJet(jet_pt, jet_eta, ev) < 2) { return; }
+            ++(*passed)[3];
+            if (copying::numBjet(jet_pt, jet_eta, ev) < 1 ||
+                copying::missingET(ev) < 20.0) {
+                return;
+            }
+            ++(*passed)[4];
+        });
+    report("copying accessors", before, num_eve);
+
+    const CutFlow after = timeCutFlow(
+        events, repeat,
+        [&](const lhco::Event &ev, std::vector<long> *passed) {
+            ++(*passed)[0];
+            if (lhco::numLeptonIso(ev) < 1) { return; }
+            ++(*passed)[1];
+            if (lhco::numMuon(lep_pt, lep_eta, ev) > 1) { return; }
+            ++(*passed)[2];
+            if (lhco::numAllJet(jet_pt, jet_eta, ev) < 2) { return; }
+            ++(*passed)[3];
+            if (lhco::numBjet(jet_pt, jet_eta, ev) < 1 ||
+                lhco::missingET(ev) < 20.0) {
+                return;
+            }
+            ++(*passed)[4];
+        });
+    report("reference accessors", after, num_eve);
+    std::cout << "-- speedup: " << before.seconds / after.seconds << '\n';
+
+    // The same cuts on the columns of batches of events.
+    std::vector<lhco::EventBatch> batches;
+    filename.clear();
+    filename.seekg(0);
+    start = std::chrono::steady_clock::now();
+    for (lhco::EventBatch batch;
+         lhco::parseEventBatch(&filename, 4096, &batch) > 0;) {
+        batches.push_back(batch);
+    }
+    const std::chrono::duration<double> parse_batches =
+        std::chrono::steady_clock::now() - start;
+    std::cout << "-- parsing: " << parse_events.count() * 1e9 / events.size()
+              << " ns/event into lhco::Event, "
+              << parse_batches.count() * 1e9 / events.size()
+              << " ns/event into lhco::EventBatch\n";
+
+    CutFlow batched;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; ++i) {
+        for (const auto &batch : batches) {
+            const auto num_lep = lhco::numLeptonIso(batch);
+            const auto num_mu = lhco::numMuon(lep_pt, lep_eta, batch);
+            const auto num_jet = lhco::numAllJet(jet_pt, jet_eta, batch);
+            const auto num_bjet = lhco::numBjet(jet_pt, jet_eta, batch);
+            const auto &met = batch.met_pt();
+            auto &passed = batched.passed;
+            for (std::size_t j = 0; j < batch.size(); ++j) {
+                const bool cut1 = num_lep[j] >= 1;
+                const bool cut2 = cut1 && num_mu[j] <= 1;
+                const bool cut3 = cut2 && num_jet[j] >= 2;
+                const bool cut4 = cut3 && num_bjet[j] >= 1 && met[j] >= 20.0;
+                ++passed[0];
+                passed[1] += cut1;
+                passed[2] += cut2;
+                passed[3] += cut3;
+                passed[4] += cut4;
+            }
+        }
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    batched.seconds = elapsed.count();
+    report("lhco::EventBatch", batched, num_eve);
+    std::cout << "-- speedup: " << before.seconds / batched.seconds << '\n';
+
+    if (before.passed != after.passed || before.passed != batched.passed) {
+        std::cerr << "-- The cut flows disagree.\n";
+        return 1;
+    }
+}
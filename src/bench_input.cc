@@ -0,0 +1,62 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "colevent_input.h"
+#include "lhco/lhco.h"
+#include "lhef/lhef.h"
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: bench_input input\n"
+                  << "    - input: Input file in LHEF or LHC Olympics "
+                  << "format (*.lhco*), optionally compressed "
+                  << "with gzip, zstd or xz\n";
+        return 1;
+    }
+
+    const std::string fname(argv[1]);
+    auto fin = colevent::openInput(fname);
+    if (!*fin) {
+        std::cerr << "-- Cannot open input file \"" << fname << "\" ("
+                  << colevent::show(fin->compression()) << ").\n";
+        return 1;
+    }
+    std::cout << "-- Reading \"" << fname << "\" ("
+              << colevent::show(fin->compression()) << ") ...\n";
+
+    const bool is_lhco = fname.find(".lhco") != std::string::npos;
+    long num_eve = 0;
+    const auto start = std::chrono::steady_clock::now();
+    if (is_lhco) {
+        for (auto ev = lhco::parseEvent(fin.get()); !ev.done();
+             ev = lhco::parseEvent(fin.get())) {
+            ++num_eve;
+        }
+    } else {
+        for (lhef::Event lhe; lhef::parseEvent(fin.get(), &lhe);) { ++num_eve; }
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    const auto stats = fin->stats();
+    const double mb = 1024.0 * 1024.0;
+    const double parse_seconds = elapsed.count() - stats.wait_seconds;
+    std::cout << "-- " << num_eve << " events in " << elapsed.count()
+              << " s\n"
+              << "---- decompression: " << stats.compressed_bytes / mb
+              << " MB -> " << stats.decompressed_bytes / mb << " MB in "
+              << stats.decompress_seconds << " s ("
+              << stats.decompressed_bytes / mb / stats.decompress_seconds
+              << " MB/s)\n"
+              << "---- parsing: " << parse_seconds << " s ("
+              << num_eve / parse_seconds << " events/s, "
+              << stats.decompressed_bytes / mb / parse_seconds << " MB/s)\n"
+              << "---- waiting for decompression: " << stats.wait_seconds
+              << " s\n";
+    if (stats.error) {
+        std::cerr << "-- Decompression failed.\n";
+        return 1;
+    }
+}
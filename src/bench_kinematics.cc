@@ -0,0 +1,190 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "colevent_batch_kinematics.h"
+#include "colevent_kinematics.h"
+#include "colevent_simd.h"
+
+// Momenta of massive particles with pT around 50 GeV over |eta| < 5.
+colevent::MomentumColumns makeMomenta(std::size_t n) {
+    std::mt19937_64 gen(20260221);
+    std::exponential_distribution<double> pt(1.0 / 50.0);
+    std::uniform_real_distribution<double> eta(-5.0, 5.0), phi(-3.14, 3.14),
+        mass(0.0, 100.0);
+    colevent::MomentumColumns momenta;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double p_t = pt(gen), phi_ = phi(gen), m = mass(gen);
+        const double px = p_t * std::cos(phi_), py = p_t * std::sin(phi_),
+                     pz = p_t * std::sinh(eta(gen));
+        const double e = std::sqrt(px * px + py * py + pz * pz + m * m);
+        momenta.add({colevent::Energy(e), colevent::Px(px), colevent::Py(py),
+                     colevent::Pz(pz)});
+    }
+    return momenta;
+}
+
+// The sum of all the variables, so that none of them is optimized away.
+struct Result {
+    double sum = 0.0;
+    double seconds = 0.0;
+};
+
+template <typename Compute>
+Result timeKinematics(int num_passes, Compute compute) {
+    Result r;
+    colevent::KinematicsColumns kin;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_passes; ++i) {
+        compute(&kin);
+        r.sum += kin.pt.back() + kin.eta.back() + kin.phi.back() +
+                 kin.mass.back() + kin.rapidity.back();
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    r.seconds = elapsed.count();
+    return r;
+}
+
+void report(const std::string &name, const Result &r, double num_particles) {
+    std::cout << "-- " << name << ": " << num_particles / r.seconds
+              << " particles/s (" << r.seconds * 1e9 / num_particles
+              << " ns/particle)\n";
+}
+
+// The deltaR between every pair of a few leptons and many jets, as in an
+// isolation cut, by `colevent::deltaR` of the pairs and by the matrices.
+void benchDeltaR(const colevent::MomentumColumns &momenta) {
+    const std::size_t n_rows = 4, n_events = 1000, n_cols = 64;
+    const int num_passes = 20;
+    std::vector<colevent::FourMomentum> particles;
+    for (std::size_t i = 0; i < momenta.size(); ++i) {
+        particles.push_back({colevent::Energy(momenta.energy[i]),
+                             colevent::Px(momenta.px[i]),
+                             colevent::Py(momenta.py[i]),
+                             colevent::Pz(momenta.pz[i])});
+    }
+    const double num_pairs = double(n_rows * n_cols * n_events) * num_passes;
+    auto report_pairs = [num_pairs](const std::string &name, double seconds,
+                                    double sum) {
+        std::cout << "-- " << name << ": " << seconds * 1e9 / num_pairs
+                  << " ns/pair (sum " << sum << ")\n";
+    };
+
+    // The particles of an event start at a different offset.
+    auto offset = [&momenta](std::size_t event) {
+        return event * 7 % (momenta.size() - n_rows - n_cols);
+    };
+    // `colevent::deltaR` of each backend, the native one last.
+    double pairwise = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed;
+    for (auto backend : {colevent::KinematicsBackend::ROOT,
+                         colevent::KinematicsBackend::Native}) {
+        if (!colevent::setKinematicsBackend(backend)) { continue; }
+        double sum = 0.0;
+        start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < num_passes; ++pass) {
+            for (std::size_t ev = 0; ev < n_events; ++ev) {
+                const auto *rows = particles.data() + offset(ev);
+                const auto *cols = rows + n_rows;
+                for (std::size_t i = 0; i < n_rows; ++i) {
+                    for (std::size_t j = 0; j < n_cols; ++j) {
+                        sum += colevent::deltaR(rows[i], cols[j]);
+                    }
+                }
+            }
+        }
+        elapsed = std::chrono::steady_clock::now() - start;
+        pairwise = elapsed.count();
+        report_pairs("deltaR of pairs, " + colevent::show(backend), pairwise,
+                     sum);
+    }
+
+    for (auto level : {colevent::SimdLevel::Scalar, colevent::SimdLevel::AVX2,
+                       colevent::SimdLevel::AVX512}) {
+        if (level > colevent::supportedSimdLevel()) { break; }
+        colevent::setSimdLevel(level);
+        colevent::EtaPhiColumns rows, cols;
+        std::vector<double> dr, min_dr;
+        double matrix_sum = 0.0, min_sum = 0.0, min_seconds = 0.0;
+        start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < num_passes; ++pass) {
+            for (std::size_t ev = 0; ev < n_events; ++ev) {
+                rows.clear();
+                cols.clear();
+                const auto *p = particles.data() + offset(ev);
+                for (std::size_t i = 0; i < n_rows; ++i, ++p) {
+                    rows.add(p->eta(), p->phi());
+                }
+                for (std::size_t j = 0; j < n_cols; ++j, ++p) {
+                    cols.add(p->eta(), p->phi());
+                }
+                colevent::deltaRMatrix(rows, cols, &dr);
+                for (double x : dr) { matrix_sum += x; }
+
+                const auto min_start = std::chrono::steady_clock::now();
+                colevent::minDeltaR(rows, cols, &min_dr);
+                min_sum += min_dr.front();
+                elapsed = std::chrono::steady_clock::now() - min_start;
+                min_seconds += elapsed.count();
+            }
+        }
+        elapsed = std::chrono::steady_clock::now() - start;
+        const double seconds = elapsed.count() - min_seconds;
+        report_pairs("deltaRMatrix, " + colevent::show(level), seconds,
+                     matrix_sum);
+        std::cout << "-- speedup: " << pairwise / seconds << '\n';
+        report_pairs("minDeltaR, " + colevent::show(level), min_seconds,
+                     min_sum);
+    }
+}
+
+int main() {
+    // The columns fit in the L2 cache.
+    const auto momenta = makeMomenta(4096);
+    const int num_passes = 2000;
+    const double num_particles = double(momenta.size()) * num_passes;
+
+    // Each variable computed by a call to the functions of `FourMomentum`.
+    const Result scalar =
+        timeKinematics(num_passes, [&momenta](colevent::KinematicsColumns *k) {
+            const std::size_t n = momenta.size();
+            k->pt.resize(n);
+            k->eta.resize(n);
+            k->phi.resize(n);
+            k->mass.resize(n);
+            k->rapidity.resize(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                const colevent::FourMomentum p{
+                    colevent::Energy(momenta.energy[i]),
+                    colevent::Px(momenta.px[i]), colevent::Py(momenta.py[i]),
+                    colevent::Pz(momenta.pz[i])};
+                k->pt[i] = p.pt();
+                k->eta[i] = p.eta();
+                k->phi[i] = p.phi();
+                k->mass[i] = p.mass();
+                k->rapidity[i] = p.rapidity();
+            }
+        });
+    report("FourMomentum", scalar, num_particles);
+
+    for (auto level : {colevent::SimdLevel::Scalar, colevent::SimdLevel::AVX2,
+                       colevent::SimdLevel::AVX512}) {
+        if (level > colevent::supportedSimdLevel()) { break; }
+        colevent::setSimdLevel(level);
+        const Result r = timeKinematics(
+            num_passes, [&momenta](colevent::KinematicsColumns *k) {
+                colevent::computeKinematics(momenta, k);
+            });
+        report("computeKinematics, " + colevent::show(level), r,
+               num_particles);
+        std::cout << "-- speedup: " << scalar.seconds / r.seconds << '\n';
+    }
+
+    benchDeltaR(momenta);
+}
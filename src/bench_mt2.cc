@@ -0,0 +1,130 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "colevent_kinematics.h"
+#include "colevent_mt2.h"
+#include "colevent_simd.h"
+#include "colevent_thread_pool.h"
+#include "lhef/particle.h"
+
+// The b-jet and lepton systems of dileptonic top quark pairs, roughly: masses
+// up to the top quark mass and pT around 60 GeV.
+colevent::MT2Columns makeEvents(std::size_t n) {
+    std::mt19937_64 gen(20260221);
+    std::exponential_distribution<double> pt(1.0 / 60.0);
+    std::uniform_real_distribution<double> phi(-3.14, 3.14), mass(20.0, 150.0),
+        pz(-200.0, 200.0);
+    auto visible = [&]() {
+        const double p_t = pt(gen), phi_ = phi(gen), m = mass(gen),
+                     p_z = pz(gen);
+        return colevent::FourMomentum{
+            colevent::Energy(std::hypot(p_t, p_z, m)),
+            colevent::Px(p_t * std::cos(phi_)),
+            colevent::Py(p_t * std::sin(phi_)), colevent::Pz(p_z)};
+    };
+    colevent::MT2Columns events;
+    events.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto vis1 = visible(), vis2 = visible();
+        const double met = pt(gen), phi_ = phi(gen);
+        events.add(vis1, vis2, met * std::cos(phi_), met * std::sin(phi_));
+    }
+    return events;
+}
+
+void report(const std::string &name, double seconds, double num_mt2,
+            double sum) {
+    std::cout << "-- " << name << ": " << num_mt2 / seconds << " MT2/s ("
+              << seconds * 1e6 / num_mt2 << " us/MT2, sum " << sum << ")\n";
+}
+
+double sum(const std::vector<double> &v) {
+    double s = 0.0;
+    for (double x : v) { s += x; }
+    return s;
+}
+
+int main() {
+    const auto events = makeEvents(20000);
+    // A scan of the trial masses of the invisible particles.
+    std::vector<colevent::MT2Hypothesis> hypotheses;
+    for (int k = 0; k < 8; ++k) { hypotheses.push_back({k * 20.0, k * 20.0}); }
+    const double num_mt2 = double(events.size()) * hypotheses.size();
+
+    // `lhef::mT2` of each event and hypothesis, one at a time.
+    // The visible systems with the same masses and pT, at pz = 0.
+    auto particle = [](double m, double px, double py) {
+        return lhef::Particle(colevent::Energy(std::hypot(px, py, m)),
+                              colevent::Px(px), colevent::Py(py),
+                              colevent::Pz(0.0));
+    };
+    lhef::Particles vis1, vis2;
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        vis1.push_back(
+            particle(events.m_vis1[i], events.px_vis1[i], events.py_vis1[i]));
+        vis2.push_back(
+            particle(events.m_vis2[i], events.px_vis2[i], events.py_vis2[i]));
+    }
+    std::vector<double> serial(events.size() * hypotheses.size());
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        for (std::size_t k = 0; k < hypotheses.size(); ++k) {
+            serial[i * hypotheses.size() + k] = lhef::mT2(
+                vis1[i], vis2[i], events.px_miss[i], events.py_miss[i],
+                hypotheses[k].m_inv1, hypotheses[k].m_inv2, false);
+        }
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    const double serial_seconds = elapsed.count();
+    report("lhef::mT2", serial_seconds, num_mt2, sum(serial));
+
+    colevent::MT2Options opts;
+    opts.print_copyright = false;
+    std::vector<double> mt2;
+    auto timeMatrix = [&](const std::string &name) {
+        start = std::chrono::steady_clock::now();
+        colevent::mT2Matrix(events, hypotheses, &mt2, opts);
+        elapsed = std::chrono::steady_clock::now() - start;
+        report("mT2Matrix, " + name, elapsed.count(), num_mt2, sum(mt2));
+        if (opts.precision == 0.0) {
+            std::cout << "-- speedup: " << serial_seconds / elapsed.count()
+                      << '\n';
+        }
+    };
+
+    // The events bisected one at a time, and in the lanes of each
+    // instruction set, on a single thread.
+    opts.num_threads = 1;
+    for (auto level : {colevent::SimdLevel::Scalar, colevent::SimdLevel::AVX2,
+                       colevent::SimdLevel::AVX512}) {
+        if (level > colevent::supportedSimdLevel()) { break; }
+        colevent::setSimdLevel(level);
+        timeMatrix(colevent::show(level) + ", 1 thread");
+    }
+
+    const unsigned max_threads = colevent::hardwareThreads();
+    for (unsigned n = 2; n <= max_threads; n *= 2) {
+        opts.num_threads = n;
+        timeMatrix(colevent::show(colevent::simdLevel()) + ", " +
+                   std::to_string(n) + " threads");
+    }
+    if (max_threads > 1) {
+        opts.num_threads = max_threads;
+        timeMatrix(colevent::show(colevent::simdLevel()) + ", " +
+                   std::to_string(max_threads) + " threads");
+    }
+
+    for (auto level :
+         {colevent::SimdLevel::Scalar, colevent::supportedSimdLevel()}) {
+        colevent::setSimdLevel(level);
+        opts.num_threads = 1;
+        opts.precision = 1e-3;
+        timeMatrix(colevent::show(level) + ", precision 1e-3");
+    }
+}
@@ -0,0 +1,263 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "colevent_mapped_file.h"
+#include "colevent_thread_pool.h"
+#include "lhco/cache.h"
+#include "lhco/lhco.h"
+#include "lhco/mapped_reader.h"
+#include "lhco/parallel_reader.h"
+
+// The parser as it was, with an `std::istringstream` for every line.
+namespace legacy {
+lhco::Object getObj(std::unique_ptr<std::istringstream> iss, const int &typ) {
+    lhco::Object obj;
+    obj.typ = typ;
+    *iss >> obj;
+    return obj;
+}
+
+lhco::RawEvent parseRawEvent(std::istream *is) {
+    std::string line;
+    lhco::Header header;
+    lhco::Objects objs;
+    lhco::RawEvent lhco;
+
+    while (std::getline(*is, line)) {
+        if (line.find("#") == std::string::npos) {
+            std::unique_ptr<std::istringstream> iss(
+                new std::istringstream(line));
+            int first_digit = 0, second_digit = 0;
+            *iss >> first_digit >> second_digit;
+            if (first_digit == 0) {
+                header.event_number = second_digit;
+                *iss >> header;
+            } else if (second_digit < 6) {
+                objs.push_back(getObj(std::move(iss), second_digit));
+            } else if (second_digit == 6) {
+                objs.push_back(getObj(std::move(iss), second_digit));
+                lhco.set_event(header, objs);
+                break;
+            } else {
+                lhco(lhco::EventStatus::Empty);
+                break;
+            }
+        }
+    }
+    return lhco;
+}
+}  // namespace legacy
+
+template <typename T>
+double sumMomenta(const std::vector<T> &ps) {
+    double sum = 0.0;
+    for (const auto &p : ps) { sum += p.energy() + p.px() + p.py() + p.pz(); }
+    return sum;
+}
+
+struct Summary {
+    int num_eve = 0;
+    long num_objects = 0;
+    double sum_pt = 0.0;
+    double sum_e = 0.0;
+    double seconds = 0.0;
+
+    void add(const lhco::RawEvent &ev) {
+        ++num_eve;
+        for (const auto &obj : ev.objects()) {
+            ++num_objects;
+            sum_pt += obj.pt;
+        }
+    }
+
+    // The objects are sorted by type in `lhco::Event`, so that `sum_pt` is
+    // summed in a different order.
+    void add(const lhco::Event &ev) {
+        ++num_eve;
+        num_objects += ev.photons().size() + ev.electrons().size() +
+                       ev.muons().size() + ev.taus().size() + ev.jets().size() +
+                       ev.bjets().size() + 1;
+    }
+
+    // Also reads the Cartesian components of all the objects.
+    void addMomenta(const lhco::Event &ev) {
+        add(ev);
+        sum_e += sumMomenta(ev.photons()) + sumMomenta(ev.electrons()) +
+                 sumMomenta(ev.muons()) + sumMomenta(ev.taus()) +
+                 sumMomenta(ev.jets()) + sumMomenta(ev.bjets());
+    }
+
+    bool operator==(const Summary &rhs) const {
+        return num_eve == rhs.num_eve && num_objects == rhs.num_objects &&
+               sum_pt == rhs.sum_pt;
+    }
+};
+
+template <typename Read>
+Summary timeRead(Read read) {
+    Summary s;
+    const auto start = std::chrono::steady_clock::now();
+    read(&s);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    s.seconds = elapsed.count();
+    return s;
+}
+
+Summary readParallel(const std::string &fname,
+                     const lhco::ParallelOptions &opts) {
+    return timeRead([&fname, &opts](Summary *s) {
+        std::mutex mutex;
+        lhco::parseEventsParallel(
+            fname,
+            [s, &mutex, &opts](const lhco::Event &ev) {
+                std::unique_lock<std::mutex> lock(mutex, std::defer_lock);
+                if (!opts.ordered) { lock.lock(); }
+                s->add(ev);
+            },
+            opts);
+    });
+}
+
+void report(const std::string &name, const Summary &s, double megabytes) {
+    std::cout << "-- " << name << ": " << s.num_eve << " events in "
+              << s.seconds << " s (" << s.num_eve / s.seconds
+              << " events/s, " << megabytes / s.seconds << " MB/s)\n";
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: bench_read_lhco input\n"
+                  << "    - input: Input file in LHC Olympics format\n";
+        return 1;
+    }
+
+    const colevent::MappedFile file(argv[1]);
+    if (!file.is_open()) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    const double megabytes = file.size() / (1024.0 * 1024.0);
+
+    const Summary legacy_summary = timeRead([&argv](Summary *s) {
+        std::ifstream fin(argv[1]);
+        for (auto ev = legacy::parseRawEvent(&fin); !ev.empty();
+             ev = legacy::parseRawEvent(&fin)) {
+            s->add(ev);
+        }
+    });
+    report("istringstream per line", legacy_summary, megabytes);
+
+    const Summary stream_summary = timeRead([&argv](Summary *s) {
+        std::ifstream fin(argv[1]);
+        for (auto ev = lhco::parseRawEvent(&fin); !ev.empty();
+             ev = lhco::parseRawEvent(&fin)) {
+            s->add(ev);
+        }
+    });
+    report("in-place tokenizer", stream_summary, megabytes);
+
+    const Summary reuse_summary = timeRead([&argv](Summary *s) {
+        std::ifstream fin(argv[1]);
+        for (lhco::RawEvent ev; lhco::parseRawEvent(&fin, &ev);) { s->add(ev); }
+    });
+    report("in-place tokenizer, reused event", reuse_summary, megabytes);
+
+    const Summary mapped_summary = timeRead([&file](Summary *s) {
+        lhco::RawEvent ev;
+        for (const char *pos = file.begin();
+             (pos = lhco::parseRawEvent(pos, file.end(), &ev)), !ev.empty();) {
+            s->add(ev);
+        }
+    });
+    report("in-place tokenizer, mmap", mapped_summary, megabytes);
+    std::cout << "-- speedup: "
+              << legacy_summary.seconds / mapped_summary.seconds << '\n';
+
+    // Building `lhco::Event`s without reading the Cartesian components, as a
+    // cut on pt and eta does, or reading all of them.
+    const Summary lazy_summary = timeRead([&file](Summary *s) {
+        lhco::Event ev;
+        for (const char *pos = file.begin();
+             (pos = lhco::parseEvent(pos, file.end(), &ev)), !ev.empty();) {
+            s->add(ev);
+        }
+    });
+    report("lhco::Event, no momenta", lazy_summary, megabytes);
+    const Summary eager_summary = timeRead([&file](Summary *s) {
+        lhco::Event ev;
+        for (const char *pos = file.begin();
+             (pos = lhco::parseEvent(pos, file.end(), &ev)), !ev.empty();) {
+            s->addMomenta(ev);
+        }
+    });
+    report("lhco::Event, momenta read", eager_summary, megabytes);
+
+    // Skipping the events searches only for the event header lines.
+    const Summary skip_summary = timeRead([&file](Summary *s) {
+        const char *pos = file.begin();
+        s->num_eve = static_cast<int>(lhco::skipEvents(
+            &pos, file.end(), std::numeric_limits<std::size_t>::max()));
+    });
+    report("skip", skip_summary, megabytes);
+    const Summary prescaled_summary = timeRead([&argv](Summary *s) {
+        lhco::MappedReader reader(argv[1]);
+        reader.prescale(10);
+        for (lhco::RawEvent ev; reader.next(&ev);) { s->add(ev); }
+    });
+    report("in-place tokenizer, mmap, prescale(10)", prescaled_summary,
+           megabytes);
+
+    // The events are read from a columnar cache file made from the input.
+    const std::string cache_fname = std::string(argv[1]) + ".cache";
+    Summary cache_summary;
+    if (lhco::convertToCache(argv[1], cache_fname)) {
+        cache_summary = timeRead([&cache_fname](Summary *s) {
+            lhco::CacheReader reader(cache_fname);
+            for (lhco::RawEvent ev; reader.next(&ev);) { s->add(ev); }
+        });
+        report("columnar cache", cache_summary, megabytes);
+        std::remove(cache_fname.c_str());
+    }
+
+    bool agree = legacy_summary == stream_summary &&
+                 legacy_summary == cache_summary &&
+                 legacy_summary == reuse_summary &&
+                 legacy_summary == mapped_summary &&
+                 lazy_summary.num_objects == legacy_summary.num_objects &&
+                 eager_summary.num_objects == legacy_summary.num_objects &&
+                 skip_summary.num_eve == legacy_summary.num_eve &&
+                 prescaled_summary.num_eve ==
+                     (legacy_summary.num_eve + 9) / 10;
+    lhco::ParallelOptions opts;
+    for (unsigned n = 1;; n *= 2) {
+        n = std::min(n, colevent::hardwareThreads());
+        opts.num_threads = n;
+        const Summary s = readParallel(argv[1], opts);
+        report("parallel, " + std::to_string(n) + " threads", s, megabytes);
+        agree = agree && s.num_eve == legacy_summary.num_eve &&
+                s.num_objects == legacy_summary.num_objects;
+        if (n == colevent::hardwareThreads()) { break; }
+    }
+    opts.ordered = false;
+    const Summary s = readParallel(argv[1], opts);
+    report("parallel, unordered", s, megabytes);
+    agree = agree && s.num_eve == legacy_summary.num_eve &&
+            s.num_objects == legacy_summary.num_objects;
+
+    if (!agree) {
+        std::cerr << "-- The parsers disagree.\n";
+        return 1;
+    }
+}
@@ -0,0 +1,203 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <string>
+#include "colevent_mapped_file.h"
+#include "colevent_thread_pool.h"
+#include "lhef/cache.h"
+#include "lhef/event_view.h"
+#include "lhef/lhef.h"
+#include "lhef/mapped_reader.h"
+#include "lhef/parallel_reader.h"
+
+struct Summary {
+    int num_eve = 0;
+    long num_particles = 0;
+    double sum_weight = 0.0;
+    double seconds = 0.0;
+
+    bool operator==(const Summary &rhs) const {
+        return num_eve == rhs.num_eve && num_particles == rhs.num_particles &&
+               sum_weight == rhs.sum_weight;
+    }
+};
+
+template <typename Reader>
+Summary readAll(Reader *reader) {
+    Summary s;
+    const auto start = std::chrono::steady_clock::now();
+    for (auto lhe = lhef::parseEvent(reader); !lhe.done();
+         lhe = lhef::parseEvent(reader)) {
+        ++s.num_eve;
+        s.num_particles += lhe.particleEntries().size();
+        s.sum_weight += lhe.eventInfo().xwgtup;
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    s.seconds = elapsed.count();
+    return s;
+}
+
+Summary readCache(lhef::CacheReader *reader) {
+    Summary s;
+    const auto start = std::chrono::steady_clock::now();
+    for (lhef::Event lhe; reader->next(&lhe);) {
+        ++s.num_eve;
+        s.num_particles += lhe.particleEntries().size();
+        s.sum_weight += lhe.eventInfo().xwgtup;
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    s.seconds = elapsed.count();
+    return s;
+}
+
+// Sums the weights, parsing only the `EventInfo` lines.
+Summary readWeights(lhef::MappedReader *reader) {
+    Summary s;
+    const auto start = std::chrono::steady_clock::now();
+    for (lhef::EventView view; lhef::parseEvent(reader, &view);) {
+        ++s.num_eve;
+        s.num_particles += view.size();
+        s.sum_weight += view.eventInfo().xwgtup;
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    s.seconds = elapsed.count();
+    return s;
+}
+
+// Only finds the events in the file.
+Summary scan(lhef::MappedReader *reader) {
+    Summary s;
+    const auto start = std::chrono::steady_clock::now();
+    for (auto text = reader->nextEventText(); text.first != text.second;
+         text = reader->nextEventText()) {
+        ++s.num_eve;
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    s.seconds = elapsed.count();
+    return s;
+}
+
+// Skips all the events, searching only for the event tags.
+Summary skipAll(lhef::MappedReader *reader) {
+    Summary s;
+    const auto start = std::chrono::steady_clock::now();
+    s.num_eve = static_cast<int>(
+        reader->skip(std::numeric_limits<std::size_t>::max()));
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    s.seconds = elapsed.count();
+    return s;
+}
+
+Summary readParallel(const std::string &fname,
+                     const lhef::ParallelOptions &opts) {
+    Summary s;
+    std::mutex mutex;
+    const auto start = std::chrono::steady_clock::now();
+    s.num_eve = lhef::parseEventsParallel(
+        fname,
+        [&s, &mutex, &opts](const lhef::Event &lhe) {
+            std::unique_lock<std::mutex> lock(mutex, std::defer_lock);
+            if (!opts.ordered) { lock.lock(); }
+            s.num_particles += lhe.particleEntries().size();
+            s.sum_weight += lhe.eventInfo().xwgtup;
+        },
+        opts);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    s.seconds = elapsed.count();
+    return s;
+}
+
+void report(const std::string &name, const Summary &s, double megabytes) {
+    std::cout << "-- " << name << ": " << s.num_eve << " events in "
+              << s.seconds << " s (" << s.num_eve / s.seconds
+              << " events/s, " << megabytes / s.seconds << " MB/s)\n";
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: bench_read_lhef input\n"
+                  << "    - input: Input file in "
+                  << "Les Houches Event File format\n";
+        return 1;
+    }
+
+    lhef::MappedReader mapped(argv[1]);
+    std::ifstream filename(argv[1]);
+    if (!filename || !mapped) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    const double megabytes =
+        colevent::MappedFile(argv[1]).size() / (1024.0 * 1024.0);
+
+    const Summary stream_summary = readAll(&filename);
+    report("std::istream", stream_summary, megabytes);
+    const Summary mapped_summary = readAll(&mapped);
+    report("mmap", mapped_summary, megabytes);
+    std::cout << "-- speedup: "
+              << stream_summary.seconds / mapped_summary.seconds << '\n';
+
+    lhef::MappedReader weights_reader(argv[1]), scan_reader(argv[1]);
+    const Summary weights_summary = readWeights(&weights_reader);
+    report("mmap, EventView (weights only)", weights_summary, megabytes);
+    const Summary scan_summary = scan(&scan_reader);
+    report("mmap, scan only", scan_summary, megabytes);
+
+    lhef::MappedReader skip_reader(argv[1]), prescaled_reader(argv[1]);
+    const Summary skip_summary = skipAll(&skip_reader);
+    report("mmap, skip", skip_summary, megabytes);
+    prescaled_reader.prescale(10);
+    const Summary prescaled_summary = readAll(&prescaled_reader);
+    report("mmap, prescale(10)", prescaled_summary, megabytes);
+
+    // The events are read from a columnar cache file made from the input.
+    const std::string cache_fname = std::string(argv[1]) + ".cache";
+    Summary cache_summary;
+    if (lhef::convertToCache(argv[1], cache_fname)) {
+        lhef::CacheReader cache_reader(cache_fname);
+        cache_summary = readCache(&cache_reader);
+        report("columnar cache", cache_summary, megabytes);
+        std::remove(cache_fname.c_str());
+    }
+
+    bool agree = stream_summary == mapped_summary &&
+                 weights_summary == stream_summary &&
+                 scan_summary.num_eve == stream_summary.num_eve &&
+                 skip_summary.num_eve == stream_summary.num_eve &&
+                 prescaled_summary.num_eve ==
+                     (stream_summary.num_eve + 9) / 10 &&
+                 cache_summary == stream_summary;
+    lhef::ParallelOptions opts;
+    for (unsigned n = 1;; n *= 2) {
+        n = std::min(n, colevent::hardwareThreads());
+        opts.num_threads = n;
+        const Summary s = readParallel(argv[1], opts);
+        report("parallel, " + std::to_string(n) + " threads", s, megabytes);
+        agree = agree && s == stream_summary;
+        if (n == colevent::hardwareThreads()) { break; }
+    }
+    opts.ordered = false;
+    const Summary s = readParallel(argv[1], opts);
+    report("parallel, unordered", s, megabytes);
+    // the weights are summed in a different order.
+    agree = agree && s.num_eve == stream_summary.num_eve &&
+            s.num_particles == stream_summary.num_particles;
+
+    if (!agree) {
+        std::cerr << "-- The readers disagree.\n";
+        return 1;
+    }
+}
@@ -0,0 +1,87 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "lhco/lhco.h"
+
+// Events with many jets, e.g., of multijet final states with pileup.
+std::vector<lhco::RawEvent> makeEvents(int num_eve, int num_jets) {
+    std::mt19937_64 gen(20260104);
+    std::exponential_distribution<double> pt(1.0 / 40.0);
+    std::uniform_real_distribution<double> eta(-4.5, 4.5), phi(-3.14, 3.14);
+    std::uniform_int_distribution<int> btag(0, 9);
+
+    std::vector<lhco::RawEvent> events;
+    for (int ieve = 0; ieve < num_eve; ++ieve) {
+        lhco::Objects objs;
+        for (int typ : {1, 2}) {
+            objs.push_back(lhco::Object(typ, eta(gen), phi(gen), 20 + pt(gen),
+                                        0.0, -1, 0, 0.0));
+        }
+        for (int i = 0; i < num_jets; ++i) {
+            objs.push_back(lhco::Object(4, eta(gen), phi(gen), 20 + pt(gen),
+                                        10.0, 5, btag(gen) == 0, 1.0));
+        }
+        objs.push_back(lhco::Object(6, 0.0, phi(gen), pt(gen), 0.0, 0, 0, 0.0));
+        events.push_back(lhco::RawEvent(lhco::Header(ieve + 1, 0), objs));
+    }
+    return events;
+}
+
+// The pT of the two leading jets summed over the events.
+struct Result {
+    double sum_pt = 0.0;
+    double seconds = 0.0;
+};
+
+template <typename Leading>
+Result timeSort(const std::vector<lhco::RawEvent> &events,
+                const lhco::SortOrder &order, Leading leading) {
+    Result r;
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto &raw : events) {
+        const lhco::Event ev = lhco::toEvent(raw, order);
+        for (const auto &jet : leading(ev.jets())) { r.sum_pt += jet.pt(); }
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    r.seconds = elapsed.count();
+    return r;
+}
+
+void report(const std::string &name, const Result &r, std::size_t num_eve) {
+    std::cout << "-- " << name << ": " << r.seconds * 1e9 / num_eve
+              << " ns/event\n";
+}
+
+int main() {
+    const auto events = makeEvents(20000, 40);
+    const auto num_eve = events.size();
+
+    auto front_two = [](const std::vector<lhco::Jet> &jets) {
+        return std::vector<lhco::Jet>(jets.cbegin(), jets.cbegin() + 2);
+    };
+    const Result full = timeSort(events, lhco::SortOrder(), front_two);
+    report("full sort", full, num_eve);
+
+    const Result topk = timeSort(
+        events, lhco::SortOrder(lhco::SortPolicy::TopK, 2), front_two);
+    report("top-2 partial sort", topk, num_eve);
+
+    const Result none =
+        timeSort(events, lhco::SortOrder(lhco::SortPolicy::None),
+                 [](const std::vector<lhco::Jet> &jets) {
+                     return lhco::leading(jets, 2);
+                 });
+    report("no sort, leading(2)", none, num_eve);
+    std::cout << "-- speedup: top-2 " << full.seconds / topk.seconds
+              << ", leading(2) " << full.seconds / none.seconds << '\n';
+
+    if (full.sum_pt != topk.sum_pt || full.sum_pt != none.sum_pt) {
+        std::cerr << "-- The leading jets differ.\n";
+        return 1;
+    }
+}
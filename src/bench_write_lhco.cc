@@ -0,0 +1,90 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "lhco/lhco.h"
+#include "lhco/writer.h"
+
+// Writes the events `repeat` times to a string stream and returns the time
+// taken in seconds.
+template <typename Write>
+double timeWrite(const std::vector<lhco::RawEvent> &events, int repeat,
+                 Write write, std::string *output) {
+    std::ostringstream os;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; ++i) { write(events, &os); }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    *output = os.str();
+    return elapsed.count();
+}
+
+void report(const std::string &name, double seconds, std::size_t num_eve,
+            std::size_t bytes) {
+    std::cout << "-- " << name << ": " << num_eve << " events in " << seconds
+              << " s (" << num_eve / seconds << " events/s, "
+              << bytes / (1024.0 * 1024.0) / seconds << " MB/s)\n";
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: bench_write_lhco input\n"
+                  << "    - input: Input file in LHC Olympics format\n";
+        return 1;
+    }
+
+    std::ifstream filename(argv[1]);
+    if (!filename) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    std::vector<lhco::RawEvent> events;
+    for (lhco::RawEvent ev; lhco::parseRawEvent(&filename, &ev);) {
+        events.push_back(ev);
+    }
+
+    const int repeat = 20;
+    const std::size_t num_eve = repeat * events.size();
+    std::string by_stream, by_writer, by_render;
+
+    const double t_stream = timeWrite(
+        events, repeat,
+        [](const std::vector<lhco::RawEvent> &evs, std::ostream *os) {
+            for (const auto &ev : evs) { *os << ev << '\n'; }
+        },
+        &by_stream);
+    report("operator<<", t_stream, num_eve, by_stream.size());
+
+    const double t_writer = timeWrite(
+        events, repeat,
+        [](const std::vector<lhco::RawEvent> &evs, std::ostream *os) {
+            lhco::Writer writer(os);
+            for (const auto &ev : evs) { writer << ev << '\n'; }
+        },
+        &by_writer);
+    report("lhco::Writer", t_writer, num_eve, by_writer.size());
+    std::cout << "-- speedup: " << t_stream / t_writer << '\n';
+
+    // All the events in one buffer, written with a single call.
+    const double t_render = timeWrite(
+        events, repeat,
+        [](const std::vector<lhco::RawEvent> &evs, std::ostream *os) {
+            std::string buf;
+            for (const auto &ev : evs) {
+                lhco::render(ev, &buf);
+                buf.push_back('\n');
+            }
+            os->write(buf.data(), static_cast<std::streamsize>(buf.size()));
+        },
+        &by_render);
+    report("lhco::render, single flush", t_render, num_eve, by_render.size());
+
+    if (by_stream != by_writer || by_stream != by_render) {
+        std::cerr << "-- The outputs differ.\n";
+        return 1;
+    }
+}
@@ -0,0 +1,77 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "lhef/lhef.h"
+#include "lhef/writer.h"
+
+// Writes the events `repeat` times to a string stream and returns the time
+// taken in seconds.
+template <typename Write>
+double timeWrite(const std::vector<lhef::Event> &events, int repeat,
+                 Write write, std::string *output) {
+    std::ostringstream os;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; ++i) { write(events, &os); }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    *output = os.str();
+    return elapsed.count();
+}
+
+void report(const std::string &name, double seconds, std::size_t num_eve,
+            std::size_t bytes) {
+    std::cout << "-- " << name << ": " << num_eve << " events in " << seconds
+              << " s (" << num_eve / seconds << " events/s, "
+              << bytes / (1024.0 * 1024.0) / seconds << " MB/s)\n";
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: bench_write_lhef input\n"
+                  << "    - input: Input file in "
+                  << "Les Houches Event File format\n";
+        return 1;
+    }
+
+    std::ifstream filename(argv[1]);
+    if (!filename) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    std::vector<lhef::Event> events;
+    for (lhef::Event lhe; lhef::parseEvent(&filename, &lhe);) {
+        events.push_back(lhe);
+    }
+
+    const int repeat = 5;
+    const std::size_t num_eve = repeat * events.size();
+    std::string by_stream, by_writer;
+
+    const double t_stream = timeWrite(
+        events, repeat,
+        [](const std::vector<lhef::Event> &evs, std::ostream *os) {
+            for (const auto &lhe : evs) { *os << lhe << '\n'; }
+        },
+        &by_stream);
+    report("operator<<", t_stream, num_eve, by_stream.size());
+
+    const double t_writer = timeWrite(
+        events, repeat,
+        [](const std::vector<lhef::Event> &evs, std::ostream *os) {
+            lhef::Writer writer(os);
+            for (const auto &lhe : evs) { writer << lhe << '\n'; }
+        },
+        &by_writer);
+    report("lhef::Writer", t_writer, num_eve, by_writer.size());
+    std::cout << "-- speedup: " << t_stream / t_writer << '\n';
+
+    if (by_stream != by_writer) {
+        std::cerr << "-- The outputs differ.\n";
+        return 1;
+    }
+}
@@ -0,0 +1,194 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "colevent_batch_kinematics.h"
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "colevent_constants.h"
+#include "colevent_kinematics.h"
+#include "colevent_simd.h"
+#include "colevent_simd_ops.h"
+
+namespace colevent {
+void MomentumColumns::clear() {
+    energy.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+}
+
+void MomentumColumns::reserve(std::size_t n) {
+    energy.reserve(n);
+    px.reserve(n);
+    py.reserve(n);
+    pz.reserve(n);
+}
+
+void MomentumColumns::add(const FourMomentum &p) {
+    energy.push_back(p.energy());
+    px.push_back(p.px());
+    py.push_back(p.py());
+    pz.push_back(p.pz());
+}
+
+void computeKinematicsScalar(const KinematicsArrays &arr) {
+    for (std::size_t i = 0; i < arr.size; ++i) {
+        const FourMomentum p{Energy(arr.energy != nullptr ? arr.energy[i] : 0),
+                             Px(arr.px[i]), Py(arr.py[i]),
+                             Pz(arr.pz != nullptr ? arr.pz[i] : 0)};
+        if (arr.pt != nullptr) { arr.pt[i] = p.pt(); }
+        if (arr.phi != nullptr) { arr.phi[i] = p.phi(); }
+        if (arr.eta != nullptr) { arr.eta[i] = p.eta(); }
+        if (arr.mass != nullptr) { arr.mass[i] = p.mass(); }
+        if (arr.rapidity != nullptr) { arr.rapidity[i] = p.rapidity(); }
+    }
+}
+
+void computeKinematics(const KinematicsArrays &arrays) {
+    switch (simdLevel()) {
+#ifdef COLEVENT_X86_SIMD
+    case SimdLevel::AVX512:
+        return simd::avx512::computeKinematics(arrays);
+    case SimdLevel::AVX2:
+        return simd::avx2::computeKinematics(arrays);
+#endif  // COLEVENT_X86_SIMD
+    default:
+        return computeKinematicsScalar(arrays);
+    }
+}
+
+void computeKinematics(const MomentumColumns &momenta,
+                       KinematicsColumns *kinematics) {
+    const std::size_t n = momenta.size();
+    kinematics->pt.resize(n);
+    kinematics->eta.resize(n);
+    kinematics->phi.resize(n);
+    kinematics->mass.resize(n);
+    kinematics->rapidity.resize(n);
+    kinematics->energy = momenta.energy;
+
+    KinematicsArrays arrays;
+    arrays.size = n;
+    arrays.energy = momenta.energy.data();
+    arrays.px = momenta.px.data();
+    arrays.py = momenta.py.data();
+    arrays.pz = momenta.pz.data();
+    arrays.pt = kinematics->pt.data();
+    arrays.eta = kinematics->eta.data();
+    arrays.phi = kinematics->phi.data();
+    arrays.mass = kinematics->mass.data();
+    arrays.rapidity = kinematics->rapidity.data();
+    computeKinematics(arrays);
+}
+
+void EtaPhiColumns::clear() {
+    eta.clear();
+    phi.clear();
+}
+
+void EtaPhiColumns::reserve(std::size_t n) {
+    eta.reserve(n);
+    phi.reserve(n);
+}
+
+EtaPhiColumns etaPhiOf(const MomentumColumns &momenta) {
+    EtaPhiColumns columns;
+    columns.eta.resize(momenta.size());
+    columns.phi.resize(momenta.size());
+    KinematicsArrays arrays;
+    arrays.size = momenta.size();
+    arrays.px = momenta.px.data();
+    arrays.py = momenta.py.data();
+    arrays.pz = momenta.pz.data();
+    arrays.eta = columns.eta.data();
+    arrays.phi = columns.phi.data();
+    computeKinematics(arrays);
+    return columns;
+}
+
+// The same as `mPi2Pi` of `colevent::deltaPhi` for |x| < 3 pi.
+double wrapPhi(double x) {
+    x = x >= PI ? x - TWOPI : x;
+    return x < -PI ? x + TWOPI : x;
+}
+
+void deltaMatricesScalar(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+                         double *dphi, double *dr) {
+    const std::size_t m = cols.size();
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        for (std::size_t j = 0; j < m; ++j) {
+            const double dp = wrapPhi(rows.phi[i] - cols.phi[j]);
+            if (dphi != nullptr) { dphi[i * m + j] = dp; }
+            if (dr != nullptr) {
+                dr[i * m + j] = std::hypot(rows.eta[i] - cols.eta[j], dp);
+            }
+        }
+    }
+}
+
+void deltaMatrices(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+                   double *dphi, double *dr) {
+    switch (simdLevel()) {
+#ifdef COLEVENT_X86_SIMD
+    case SimdLevel::AVX512:
+        return simd::avx512::deltaMatrices(rows, cols, dphi, dr);
+    case SimdLevel::AVX2:
+        return simd::avx2::deltaMatrices(rows, cols, dphi, dr);
+#endif  // COLEVENT_X86_SIMD
+    default:
+        return deltaMatricesScalar(rows, cols, dphi, dr);
+    }
+}
+
+void deltaPhiMatrix(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+                    std::vector<double> *dphi) {
+    dphi->resize(rows.size() * cols.size());
+    deltaMatrices(rows, cols, dphi->data(), nullptr);
+}
+
+void deltaRMatrix(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+                  std::vector<double> *dr) {
+    dr->resize(rows.size() * cols.size());
+    deltaMatrices(rows, cols, nullptr, dr->data());
+}
+
+void minDeltaRScalar(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+                     double *min_dr, int *closest) {
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        double best = std::numeric_limits<double>::infinity();
+        int best_index = -1;
+        for (std::size_t j = 0; j < cols.size(); ++j) {
+            const double dr = std::hypot(rows.eta[i] - cols.eta[j],
+                                         wrapPhi(rows.phi[i] - cols.phi[j]));
+            if (dr < best) {
+                best = dr;
+                best_index = static_cast<int>(j);
+            }
+        }
+        min_dr[i] = best;
+        if (closest != nullptr) { closest[i] = best_index; }
+    }
+}
+
+void minDeltaR(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+               std::vector<double> *min_dr, std::vector<int> *closest) {
+    min_dr->resize(rows.size());
+    int *closest_data = nullptr;
+    if (closest != nullptr) {
+        closest->resize(rows.size());
+        closest_data = closest->data();
+    }
+    switch (simdLevel()) {
+#ifdef COLEVENT_X86_SIMD
+    case SimdLevel::AVX512:
+        return simd::avx512::minDeltaR(rows, cols, min_dr->data(),
+                                       closest_data);
+    case SimdLevel::AVX2:
+        return simd::avx2::minDeltaR(rows, cols, min_dr->data(), closest_data);
+#endif  // COLEVENT_X86_SIMD
+    default:
+        return minDeltaRScalar(rows, cols, min_dr->data(), closest_data);
+    }
+}
+}  // namespace colevent
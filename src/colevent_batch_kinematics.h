@@ -0,0 +1,106 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_COLEVENT_BATCH_KINEMATICS_H_
+#define COLEVENT_SRC_COLEVENT_BATCH_KINEMATICS_H_
+
+#include <cstddef>
+#include <vector>
+#include "colevent_kinematics.h"
+
+namespace colevent {
+// Four-momenta as a structure of arrays: the i-th momentum is
+// (energy[i], px[i], py[i], pz[i]).
+struct MomentumColumns {
+    std::vector<double> energy, px, py, pz;
+
+    std::size_t size() const { return px.size(); }
+    void clear();
+    void reserve(std::size_t n);
+    void add(const FourMomentum &p);
+};
+
+// The kinematic variables of `MomentumColumns`, with the same indices.
+struct KinematicsColumns {
+    std::vector<double> pt, eta, phi, mass, rapidity, energy;
+};
+
+// Arrays of `size` values, e.g., owned by the caller. The variables whose
+// output array is null are not computed. `px` and `py` are always read,
+// `pz` for eta, mass and rapidity, and `energy` for mass and rapidity.
+struct KinematicsArrays {
+    std::size_t size = 0;
+    const double *energy = nullptr;
+    const double *px = nullptr;
+    const double *py = nullptr;
+    const double *pz = nullptr;
+    double *pt = nullptr;
+    double *eta = nullptr;
+    double *phi = nullptr;
+    double *mass = nullptr;
+    double *rapidity = nullptr;
+};
+
+// Computes the variables of `FourMomentum::pt()`, `eta()`, `phi()`, `mass()`
+// and `rapidity()` for all the momenta in one pass, with the instruction set
+// of `colevent::simdLevel()`. The scalar level calls the functions of
+// `FourMomentum`. For finite momenta, the vectorized results differ from
+// them by at most
+//   pt: 1 ulp (the sum of squares is not scaled as by `std::hypot`),
+//   eta, rapidity: 2 ulp (the logarithm),
+//   phi: 2 ulp (the arctangent),
+//   mass: 0 ulp.
+void computeKinematics(const KinematicsArrays &arrays);
+
+// The same as above. The energy is copied from the momenta.
+void computeKinematics(const MomentumColumns &momenta,
+                       KinematicsColumns *kinematics);
+
+// The pseudorapidities and azimuthal angles of a collection, e.g., the jets
+// of an event, for the matrices below, so that each of them is computed
+// once instead of in every call of `colevent::deltaR`.
+struct EtaPhiColumns {
+    std::vector<double> eta, phi;
+
+    std::size_t size() const { return eta.size(); }
+    void clear();
+    void reserve(std::size_t n);
+    void add(double eta_value, double phi_value) {
+        eta.push_back(eta_value);
+        phi.push_back(phi_value);
+    }
+};
+
+// By `colevent::computeKinematics`.
+EtaPhiColumns etaPhiOf(const MomentumColumns &momenta);
+
+// For objects having `eta()` and `phi()`, e.g., `lhco::Jet`.
+template <typename T>
+EtaPhiColumns etaPhiOf(const std::vector<T> &objects) {
+    EtaPhiColumns columns;
+    columns.reserve(objects.size());
+    for (const auto &obj : objects) { columns.add(obj.eta(), obj.phi()); }
+    return columns;
+}
+
+// The n x m matrices of `colevent::deltaPhi` and `colevent::deltaR` between
+// the n rows and the m columns, stored row by row: the element (i, j) is at
+// i * m + j. The difference of the angles is wrapped into [-pi, pi) without
+// branches, exactly as `colevent::deltaPhi` does if it is less than 3 pi in
+// magnitude, e.g., for angles in [-pi, pi] or [0, 2 pi]. deltaR differs by
+// at most 1 ulp from `std::hypot` of deta and dphi.
+void deltaPhiMatrix(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+                    std::vector<double> *dphi);
+
+void deltaRMatrix(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+                  std::vector<double> *dr);
+
+// The smallest deltaR of each row to the columns, and the index of the
+// closest column if `closest` is not null, without filling the matrix,
+// e.g., for isolation cuts. It is infinity with the index -1 if there are
+// no columns.
+void minDeltaR(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+               std::vector<double> *min_dr,
+               std::vector<int> *closest = nullptr);
+}  // namespace colevent
+
+#endif  // COLEVENT_SRC_COLEVENT_BATCH_KINEMATICS_H_
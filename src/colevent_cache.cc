@@ -0,0 +1,75 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "colevent_columnar.h"
+#include "colevent_mapped_file.h"
+#include "lhco/cache.h"
+#include "lhco/parser.h"
+#include "lhef/cache.h"
+#include "lhef/mapped_reader.h"
+
+using colevent::EventFormat;
+
+// The format of a text file from its content: LHEF if it has an `<event` tag,
+// LHCO if it has an event header line. It returns false if neither is found.
+bool detectFormat(const std::string &fname, EventFormat *format) {
+    const colevent::MappedFile file(fname);
+    if (!file.is_open()) { return false; }
+    if (lhef::findEventTag(file.begin(), file.end()) != file.end()) {
+        *format = EventFormat::LHEF;
+        return true;
+    }
+    if (lhco::findHeaderLine(file.begin(), file.end()) != file.end()) {
+        *format = EventFormat::LHCO;
+        return true;
+    }
+    return false;
+}
+
+// Converts an LHEF or LHCO text file to a columnar cache file, or a cache
+// file back to text. The format of a text file is detected from its content.
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: colevent-cache input output\n"
+                  << "    - input: Input file in LHEF or LHC Olympics format,"
+                  << " or a cache file\n"
+                  << "    - output: Cache file, or text file for a cache"
+                  << " file as input\n";
+        return 1;
+    }
+    const std::string input(argv[1]), output(argv[2]);
+
+    if (colevent::isColumnarFile(input)) {
+        std::ofstream fout(output);
+        if (!fout) {
+            std::cerr << "-- Cannot open output file \"" << output << "\".\n";
+            return 1;
+        }
+        const colevent::ColumnarFile file(input);
+        const bool ok = file.format() == EventFormat::LHCO
+                            ? lhco::convertToText(input, &fout)
+                            : lhef::convertToText(input, &fout);
+        if (!ok) {
+            std::cerr << "-- Cannot convert \"" << input << "\" to text.\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    EventFormat format;
+    if (!detectFormat(input, &format)) {
+        std::cerr << "-- No events in LHEF or LHC Olympics format in \""
+                  << input << "\".\n";
+        return 1;
+    }
+    const bool ok = format == EventFormat::LHCO
+                        ? lhco::convertToCache(input, output)
+                        : lhef::convertToCache(input, output);
+    if (!ok) {
+        std::cerr << "-- Cannot convert \"" << input << "\" to \"" << output
+                  << "\".\n";
+        return 1;
+    }
+}
@@ -0,0 +1,124 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_COLEVENT_CHARCONV_H_
+#define COLEVENT_SRC_COLEVENT_CHARCONV_H_
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+namespace colevent {
+inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Returns the beginning of the line after the one containing `first`.
+inline const char *nextLine(const char *first, const char *last) {
+    const void *nl = std::memchr(first, '\n', last - first);
+    return nl == nullptr ? last : static_cast<const char *>(nl) + 1;
+}
+
+// Extracts whitespace-separated numbers from the characters in [first, last)
+// without copying them. It mimics `operator>>` of `std::istream`: once an
+// extraction fails, the reader stops and all the following values are zero.
+// Lines starting with '#' are skipped as comments.
+class TokenReader {
+private:
+    const char *pos_;
+    const char *last_;
+    bool line_start_ = true;
+    bool good_ = true;
+
+public:
+    TokenReader(const char *first, const char *last)
+        : pos_(first), last_(last) {}
+
+    const char *position() const { return pos_; }
+    bool good() const { return good_; }
+    explicit operator bool() const { return good_; }
+
+    template <typename T>
+    TokenReader &operator>>(T &value) {
+        value = T();
+        if (!good_) { return *this; }
+
+        skipBlanks();
+        const char *first = pos_;
+        if (first != last_ && *first == '+') { ++first; }
+        auto result = std::from_chars(first, last_, value);
+        if (result.ec != std::errc()) {
+            value = T();
+            good_ = false;
+        } else {
+            pos_ = result.ptr;
+            line_start_ = false;
+        }
+        return *this;
+    }
+
+private:
+    void skipBlanks() {
+        while (pos_ != last_) {
+            if (*pos_ == '\n') {
+                ++pos_;
+                line_start_ = true;
+            } else if (line_start_ && *pos_ == '#') {  // comment line
+                pos_ = nextLine(pos_, last_);
+            } else if (isBlank(*pos_)) {
+                ++pos_;
+                line_start_ = false;
+            } else {
+                break;
+            }
+        }
+    }
+};
+
+// Formatting into a string buffer with `std::to_chars`. The output is the
+// same as that of `std::ostream` with `std::setw(width)` and, for the floating
+// point numbers, `std::setprecision(precision)` with `std::scientific` and
+// `std::uppercase` or with `std::fixed`.
+inline void appendPadded(std::string *out, const char *first, const char *last,
+                         int width) {
+    const auto n = static_cast<int>(last - first);
+    if (n < width) { out->append(width - n, ' '); }
+    out->append(first, last);
+}
+
+template <typename Int>
+inline void appendInt(std::string *out, Int value, int width) {
+    char buf[24];
+    const auto result = std::to_chars(buf, buf + sizeof buf, value);
+    appendPadded(out, buf, result.ptr, width);
+}
+
+inline void toUpper(char *first, char *last) {
+    for (; first != last; ++first) {
+        if (*first >= 'a' && *first <= 'z') { *first += 'A' - 'a'; }
+    }
+}
+
+inline void appendScientific(std::string *out, double value, int precision,
+                             int width) {
+    char buf[64];
+    const auto result = std::to_chars(buf, buf + sizeof buf, value,
+                                      std::chars_format::scientific, precision);
+    toUpper(buf, result.ptr);
+    appendPadded(out, buf, result.ptr, width);
+}
+
+// Infinities and NaNs are in lowercase as `std::uppercase` does not apply to
+// `std::fixed` in libstdc++.
+inline void appendFixed(std::string *out, double value, int precision,
+                        int width) {
+    // Large enough for any double with up to 60 digits after the point.
+    char buf[384];
+    const auto result = std::to_chars(buf, buf + sizeof buf, value,
+                                      std::chars_format::fixed, precision);
+    appendPadded(out, buf, result.ptr, width);
+}
+}  // namespace colevent
+
+#endif  // COLEVENT_SRC_COLEVENT_CHARCONV_H_
@@ -0,0 +1,162 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "colevent_columnar.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace colevent {
+namespace {
+constexpr char kColumnarMagic[8] = {'C', 'E', 'V', 'C', 'O', 'L', '\0', '\0'};
+constexpr std::uint32_t kColumnarVersion = 1;
+constexpr std::uint64_t kHeaderSize = 24;
+constexpr std::uint64_t kTrailerSize = 24;
+
+std::uint64_t padding(std::uint64_t size) { return (8 - size % 8) % 8; }
+
+std::uint64_t load64(const char *p) {
+    std::uint64_t w;
+    std::memcpy(&w, p, sizeof w);
+    return w;
+}
+
+std::uint32_t load32(const char *p) {
+    std::uint32_t w;
+    std::memcpy(&w, p, sizeof w);
+    return w;
+}
+}  // namespace
+
+ColumnarWriter::ColumnarWriter(const std::string &fname, EventFormat format,
+                               std::uint32_t num_columns,
+                               std::string_view metadata)
+    : out_(fname, std::ios::binary | std::ios::trunc),
+      num_columns_(num_columns) {
+    const auto version = kColumnarVersion;
+    const auto fmt = static_cast<std::uint32_t>(format);
+    const std::uint32_t pad = 0;
+    out_.write(kColumnarMagic, sizeof kColumnarMagic);
+    out_.write(reinterpret_cast<const char *>(&version), sizeof version);
+    out_.write(reinterpret_cast<const char *>(&fmt), sizeof fmt);
+    out_.write(reinterpret_cast<const char *>(&num_columns),
+               sizeof num_columns);
+    out_.write(reinterpret_cast<const char *>(&pad), sizeof pad);
+    pos_ = kHeaderSize;
+
+    metadata_offset_ = pos_;
+    metadata_size_ = metadata.size();
+    writeBlock(metadata);
+}
+
+void ColumnarWriter::writeBlock(std::string_view bytes) {
+    static const char zeros[8] = {};
+    out_.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    const auto pad = padding(bytes.size());
+    out_.write(zeros, static_cast<std::streamsize>(pad));
+    pos_ += bytes.size() + pad;
+}
+
+bool ColumnarWriter::writeRowGroup(
+    std::uint64_t num_events, std::uint64_t num_rows,
+    const std::vector<std::string_view> &columns) {
+    if (!is_open() || columns.size() != num_columns_) { return false; }
+    footer_.push_back(num_events);
+    footer_.push_back(num_rows);
+    for (const auto &column : columns) {
+        footer_.push_back(pos_);
+        footer_.push_back(column.size());
+        writeBlock(column);
+    }
+    ++num_groups_;
+    return static_cast<bool>(out_);
+}
+
+bool ColumnarWriter::close() {
+    if (!is_open()) { return false; }
+    closed_ = true;
+
+    const std::uint64_t footer_offset = pos_;
+    out_.write(reinterpret_cast<const char *>(&metadata_offset_),
+               sizeof metadata_offset_);
+    out_.write(reinterpret_cast<const char *>(&metadata_size_),
+               sizeof metadata_size_);
+    out_.write(reinterpret_cast<const char *>(footer_.data()),
+               static_cast<std::streamsize>(footer_.size() *
+                                            sizeof(std::uint64_t)));
+    out_.write(reinterpret_cast<const char *>(&num_groups_),
+               sizeof num_groups_);
+    out_.write(reinterpret_cast<const char *>(&footer_offset),
+               sizeof footer_offset);
+    out_.write(kColumnarMagic, sizeof kColumnarMagic);
+    out_.close();
+    return static_cast<bool>(out_);
+}
+
+ColumnarFile::ColumnarFile(const std::string &fname) : file_(fname) {
+    open_ = file_.is_open() && readFooter();
+}
+
+bool ColumnarFile::readFooter() {
+    const char *first = file_.begin();
+    const std::uint64_t size = file_.size();
+    if (size < kHeaderSize + kTrailerSize ||
+        std::memcmp(first, kColumnarMagic, sizeof kColumnarMagic) != 0 ||
+        std::memcmp(first + size - sizeof kColumnarMagic, kColumnarMagic,
+                    sizeof kColumnarMagic) != 0 ||
+        load32(first + 8) != kColumnarVersion || load32(first + 12) > 1) {
+        return false;
+    }
+    format_ = static_cast<EventFormat>(load32(first + 12));
+    num_columns_ = load32(first + 16);
+
+    const char *trailer = first + size - kTrailerSize;
+    const std::uint64_t num_groups = load64(trailer);
+    const std::uint64_t footer_offset = load64(trailer + 8);
+    const std::uint64_t footer_end = size - kTrailerSize;
+    const std::uint64_t group_size = 16 * (1 + std::uint64_t(num_columns_));
+    if (footer_offset < kHeaderSize || footer_offset > footer_end ||
+        footer_end - footer_offset < 16 ||
+        (footer_end - footer_offset - 16) / group_size < num_groups) {
+        return false;
+    }
+
+    // Every block must lie between the header and the footer.
+    auto valid = [footer_offset](std::uint64_t offset, std::uint64_t n) {
+        return offset >= kHeaderSize && offset % 8 == 0 &&
+               offset <= footer_offset && n <= footer_offset - offset;
+    };
+    const char *pos = first + footer_offset;
+    const std::uint64_t metadata_offset = load64(pos);
+    const std::uint64_t metadata_size = load64(pos + 8);
+    if (!valid(metadata_offset, metadata_size)) { return false; }
+    metadata_ = std::string_view(first + metadata_offset, metadata_size);
+    pos += 16;
+
+    groups_.resize(num_groups);
+    for (auto &group : groups_) {
+        group.num_events = load64(pos);
+        group.num_rows = load64(pos + 8);
+        pos += 16;
+        group.columns.resize(num_columns_);
+        for (auto &column : group.columns) {
+            const std::uint64_t offset = load64(pos);
+            const std::uint64_t n = load64(pos + 8);
+            pos += 16;
+            if (!valid(offset, n)) { return false; }
+            column = std::string_view(first + offset, n);
+        }
+        num_events_ += group.num_events;
+    }
+    return true;
+}
+
+bool isColumnarFile(const std::string &fname) {
+    std::ifstream fin(fname, std::ios::binary);
+    char magic[sizeof kColumnarMagic];
+    fin.read(magic, sizeof magic);
+    return fin && std::memcmp(magic, kColumnarMagic, sizeof magic) == 0;
+}
+}  // namespace colevent
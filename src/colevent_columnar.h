@@ -0,0 +1,122 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_COLEVENT_COLUMNAR_H_
+#define COLEVENT_SRC_COLEVENT_COLUMNAR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "colevent_event_index.h"
+#include "colevent_mapped_file.h"
+
+namespace colevent {
+// A binary file of events stored column by column, to be read many times
+// without parsing text. The events are stored in row groups, each of which
+// holds the same columns: arrays of fixed-size values with one value per
+// event or per row, i.e., per particle or object. The schema of the columns
+// is defined by `lhef::CacheWriter` and `lhco::CacheWriter`.
+//
+// Layout, in the byte order of the machine:
+//   magic (8 bytes), version (uint32), format (uint32),
+//   number of columns (uint32), padding (uint32),
+//   metadata, e.g., the text before the first event,
+//   row groups, each with the columns one after another,
+//   footer: the offset and size (uint64 each) of the metadata, then for each
+//     row group the number of events and of rows (uint64 each) followed by
+//     the offset and size of each column (uint64 each),
+//   trailer: number of row groups (uint64), offset of the footer (uint64)
+//     and the magic.
+// All the blocks start at multiples of 8 bytes, so that the columns can be
+// read in place from a memory-mapped file.
+class ColumnarWriter {
+private:
+    std::ofstream out_;
+    std::uint32_t num_columns_ = 0;
+    std::uint64_t pos_ = 0;
+    std::uint64_t metadata_offset_ = 0;
+    std::uint64_t metadata_size_ = 0;
+    std::vector<std::uint64_t> footer_;
+    std::uint64_t num_groups_ = 0;
+    bool closed_ = false;
+
+public:
+    ColumnarWriter(const std::string &fname, EventFormat format,
+                   std::uint32_t num_columns, std::string_view metadata);
+    ~ColumnarWriter() { close(); }
+
+    ColumnarWriter(const ColumnarWriter &) = delete;
+    ColumnarWriter &operator=(const ColumnarWriter &) = delete;
+
+    bool is_open() const { return out_.is_open() && !closed_; }
+
+    // Appends a row group. `columns` are the bytes of the columns in the
+    // order of the schema. It returns false if the number of columns does
+    // not match or the file cannot be written.
+    bool writeRowGroup(std::uint64_t num_events, std::uint64_t num_rows,
+                       const std::vector<std::string_view> &columns);
+
+    // Writes the footer and closes the file.
+    bool close();
+
+private:
+    void writeBlock(std::string_view bytes);
+};
+
+template <typename T>
+std::string_view bytesOf(const std::vector<T> &values) {
+    return {reinterpret_cast<const char *>(values.data()),
+            values.size() * sizeof(T)};
+}
+
+struct RowGroup {
+    std::uint64_t num_events = 0;
+    std::uint64_t num_rows = 0;
+    std::vector<std::string_view> columns;
+
+    // The values of the column `i`, which are aligned for any type.
+    template <typename T>
+    const T *column(std::size_t i) const {
+        return reinterpret_cast<const T *>(columns[i].data());
+    }
+    // Whether the column `i` holds `n` values of `T`.
+    template <typename T>
+    bool hasColumn(std::size_t i, std::uint64_t n) const {
+        return i < columns.size() && columns[i].size() == n * sizeof(T);
+    }
+};
+
+// Memory-mapped columnar file. It is not open if the file is not a valid
+// columnar file.
+class ColumnarFile {
+private:
+    MappedFile file_;
+    EventFormat format_ = EventFormat::LHEF;
+    std::uint32_t num_columns_ = 0;
+    std::string_view metadata_;
+    std::vector<RowGroup> groups_;
+    std::uint64_t num_events_ = 0;
+    bool open_ = false;
+
+public:
+    ColumnarFile() {}
+    explicit ColumnarFile(const std::string &fname);
+
+    bool is_open() const { return open_; }
+    EventFormat format() const { return format_; }
+    std::uint32_t numColumns() const { return num_columns_; }
+    std::string_view metadata() const { return metadata_; }
+    const std::vector<RowGroup> &rowGroups() const { return groups_; }
+    std::uint64_t numEvents() const { return num_events_; }
+
+private:
+    bool readFooter();
+};
+
+// Whether the file starts with the magic of a columnar file.
+bool isColumnarFile(const std::string &fname);
+}  // namespace colevent
+
+#endif  // COLEVENT_SRC_COLEVENT_COLUMNAR_H_
@@ -0,0 +1,294 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "colevent_event_index.h"
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <string>
+#include <vector>
+#include "colevent_charconv.h"
+#include "colevent_input.h"
+#include "colevent_mapped_file.h"
+#include "lhef/mapped_reader.h"
+
+namespace colevent {
+namespace {
+// Layout of the sidecar file, in the byte order of the machine:
+//   magic (8 bytes), version (uint32), format (uint32), source size (uint64),
+//   source modification time (int64), checksum (uint64), number of events
+//   (uint64), offsets (uint64 each).
+constexpr char kIndexMagic[8] = {'C', 'E', 'V', 'I', 'D', 'X', '\0', '\0'};
+constexpr std::uint32_t kIndexVersion = 2;
+
+// The file is scanned in blocks so that the checksum and the search for the
+// events read the bytes while they are still in the cache.
+constexpr std::size_t kBlockSize = 1 << 20;
+
+constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+
+inline std::uint64_t rotl(std::uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline std::uint64_t load64(const char *p) {
+    std::uint64_t w;
+    std::memcpy(&w, p, sizeof w);
+    return w;
+}
+
+// A streaming hash with four independent lanes over 32-byte stripes, in the
+// style of xxHash64.
+class Hasher {
+private:
+    std::uint64_t acc_[4] = {kPrime1 + kPrime2, kPrime2, 0, 0 - kPrime1};
+    std::uint64_t length_ = 0;
+    const char *tail_ = nullptr;
+    std::size_t tail_size_ = 0;
+
+    static std::uint64_t round(std::uint64_t acc, std::uint64_t w) {
+        return rotl(acc + w * kPrime2, 31) * kPrime1;
+    }
+
+public:
+    // `n` must be a multiple of 32 unless it is the last call.
+    void update(const char *p, std::size_t n) {
+        length_ += n;
+        const char *stripes_end = p + (n & ~std::size_t(31));
+        for (; p != stripes_end; p += 32) {
+            acc_[0] = round(acc_[0], load64(p));
+            acc_[1] = round(acc_[1], load64(p + 8));
+            acc_[2] = round(acc_[2], load64(p + 16));
+            acc_[3] = round(acc_[3], load64(p + 24));
+        }
+        tail_ = p;
+        tail_size_ = n & 31;
+    }
+
+    std::uint64_t finish() const {
+        std::uint64_t h = rotl(acc_[0], 1) + rotl(acc_[1], 7) +
+                          rotl(acc_[2], 12) + rotl(acc_[3], 18);
+        h += length_;
+        const char *p = tail_;
+        std::size_t n = tail_size_;
+        for (; n >= 8; p += 8, n -= 8) {
+            h = rotl(h ^ round(0, load64(p)), 27) * kPrime1 + kPrime3;
+        }
+        for (; n > 0; ++p, --n) {
+            h = rotl(h ^ (static_cast<unsigned char>(*p) * kPrime3), 11) *
+                kPrime1;
+        }
+        h ^= h >> 33;
+        h *= kPrime2;
+        h ^= h >> 29;
+        h *= kPrime3;
+        h ^= h >> 32;
+        return h;
+    }
+};
+
+// The size of the file and its modification time in nanoseconds since the
+// epoch. It returns false if the status of the file cannot be read.
+bool fileStatus(const std::string &fname, std::uint64_t *size,
+                std::int64_t *mtime) {
+    struct stat st;
+    if (::stat(fname.c_str(), &st) != 0) { return false; }
+#ifdef __APPLE__
+    const struct timespec &t = st.st_mtimespec;
+#else
+    const struct timespec &t = st.st_mtim;
+#endif  // __APPLE__
+    *size = static_cast<std::uint64_t>(st.st_size);
+    *mtime = static_cast<std::int64_t>(t.tv_sec) * 1000000000 + t.tv_nsec;
+    return true;
+}
+
+// Whether the line starting at `line` is an LHCO event header, whose first
+// field is `0`.
+bool isLHCOHeader(const char *line, const char *last) {
+    while (line != last && isBlank(*line)) { ++line; }
+    if (line == last || *line != '0') { return false; }
+    ++line;
+    return line == last || isBlank(*line) || *line == '\n';
+}
+}  // namespace
+
+std::vector<EventIndex::EventRange> EventIndex::shards(std::size_t k) const {
+    std::vector<EventRange> ranges;
+    if (offsets_.empty() || k == 0) { return ranges; }
+
+    const std::uint64_t begin = offsets_.front();
+    const std::uint64_t total = source_size_ - begin;
+    std::size_t first = 0;
+    for (std::size_t s = 1; s <= k && first < offsets_.size(); ++s) {
+        std::size_t last = offsets_.size();
+        if (s < k) {
+            // The first event starting at or after the target boundary.
+            const std::uint64_t target = begin + total * s / k;
+            last = std::lower_bound(offsets_.cbegin() + first, offsets_.cend(),
+                                    target) -
+                   offsets_.cbegin();
+        }
+        if (last > first) {
+            ranges.push_back({first, last});
+            first = last;
+        }
+    }
+    return ranges;
+}
+
+std::uint64_t checksum(const char *first, const char *last) {
+    Hasher hasher;
+    hasher.update(first, last - first);
+    return hasher.finish();
+}
+
+EventIndex buildIndex(const char *first, const char *last, EventFormat format) {
+    Hasher hasher;
+    std::vector<std::uint64_t> offsets;
+
+    const char *next_event = format == EventFormat::LHEF
+                                 ? lhef::findEventTag(first, last)
+                                 : first;  // the next line to examine for LHCO
+    for (const char *block = first; block != last;) {
+        const std::size_t n =
+            std::min(kBlockSize, static_cast<std::size_t>(last - block));
+        const char *block_end = block + n;
+        hasher.update(block, n);
+
+        if (format == EventFormat::LHEF) {
+            while (next_event < block_end) {
+                offsets.push_back(next_event - first);
+                next_event = lhef::findEventTag(next_event + 1, last);
+            }
+        } else {
+            while (next_event < block_end) {
+                if (isLHCOHeader(next_event, last)) {
+                    offsets.push_back(next_event - first);
+                }
+                next_event = nextLine(next_event, last);
+            }
+        }
+        block = block_end;
+    }
+
+    return EventIndex(format, last - first, hasher.finish(),
+                      std::move(offsets));
+}
+
+bool buildIndex(const std::string &fname, EventFormat format,
+                EventIndex *index) {
+    // Taken before the mapping, so that a later change makes the index stale.
+    std::uint64_t size = 0;
+    std::int64_t mtime = 0;
+    if (!fileStatus(fname, &size, &mtime)) { return false; }
+    const MappedFile file(fname);
+    if (!file.is_open()) { return false; }
+    // The offsets of a compressed file would not point to the events.
+    const auto magic = reinterpret_cast<const unsigned char *>(file.begin());
+    if (detectCompression(magic, file.size()) != Compression::None) {
+        return false;
+    }
+    *index = buildIndex(file.begin(), file.end(), format);
+    index->setSourceMTime(mtime);
+    return true;
+}
+
+bool readIndex(const std::string &idx_fname, EventIndex *index) {
+    std::ifstream fin(idx_fname, std::ios::binary);
+    if (!fin) { return false; }
+
+    char magic[sizeof kIndexMagic];
+    std::uint32_t version = 0, format = 0;
+    std::uint64_t source_size = 0, sum = 0, num_eve = 0;
+    std::int64_t mtime = 0;
+    fin.read(magic, sizeof magic);
+    fin.read(reinterpret_cast<char *>(&version), sizeof version);
+    fin.read(reinterpret_cast<char *>(&format), sizeof format);
+    fin.read(reinterpret_cast<char *>(&source_size), sizeof source_size);
+    fin.read(reinterpret_cast<char *>(&mtime), sizeof mtime);
+    fin.read(reinterpret_cast<char *>(&sum), sizeof sum);
+    fin.read(reinterpret_cast<char *>(&num_eve), sizeof num_eve);
+    if (!fin || std::memcmp(magic, kIndexMagic, sizeof magic) != 0 ||
+        version != kIndexVersion || format > 1 ||
+        num_eve > source_size) {
+        return false;
+    }
+
+    std::vector<std::uint64_t> offsets(num_eve);
+    fin.read(reinterpret_cast<char *>(offsets.data()),
+             num_eve * sizeof(std::uint64_t));
+    if (!fin) { return false; }
+    if (!std::is_sorted(offsets.cbegin(), offsets.cend()) ||
+        (!offsets.empty() && offsets.back() >= source_size)) {
+        return false;
+    }
+
+    *index = EventIndex(static_cast<EventFormat>(format), source_size, sum,
+                        std::move(offsets));
+    index->setSourceMTime(mtime);
+    return true;
+}
+
+bool writeIndex(const std::string &idx_fname, const EventIndex &index) {
+    std::ofstream fout(idx_fname, std::ios::binary | std::ios::trunc);
+    if (!fout) { return false; }
+
+    const auto version = kIndexVersion;
+    const auto format = static_cast<std::uint32_t>(index.format());
+    const std::uint64_t source_size = index.sourceSize();
+    const std::int64_t mtime = index.sourceMTime();
+    const std::uint64_t sum = index.checksum();
+    const std::uint64_t num_eve = index.size();
+    fout.write(kIndexMagic, sizeof kIndexMagic);
+    fout.write(reinterpret_cast<const char *>(&version), sizeof version);
+    fout.write(reinterpret_cast<const char *>(&format), sizeof format);
+    fout.write(reinterpret_cast<const char *>(&source_size),
+               sizeof source_size);
+    fout.write(reinterpret_cast<const char *>(&mtime), sizeof mtime);
+    fout.write(reinterpret_cast<const char *>(&sum), sizeof sum);
+    fout.write(reinterpret_cast<const char *>(&num_eve), sizeof num_eve);
+    fout.write(reinterpret_cast<const char *>(index.offsets().data()),
+               num_eve * sizeof(std::uint64_t));
+    fout.close();
+    return static_cast<bool>(fout);
+}
+
+bool isIndexOf(const EventIndex &index, const std::string &fname,
+               bool verify_checksum) {
+    std::uint64_t size = 0;
+    std::int64_t mtime = 0;
+    if (!fileStatus(fname, &size, &mtime) || size != index.sourceSize() ||
+        mtime != index.sourceMTime()) {
+        return false;
+    }
+    if (!verify_checksum) { return true; }
+    const MappedFile file(fname);
+    return file.is_open() && file.size() == index.sourceSize() &&
+           checksum(file.begin(), file.end()) == index.checksum();
+}
+
+bool loadIndex(const std::string &fname, EventFormat format, EventIndex *index,
+               bool verify_checksum) {
+    const std::string idx_fname = indexFileName(fname);
+    if (readIndex(idx_fname, index) && index->format() == format &&
+        isIndexOf(*index, fname, verify_checksum)) {
+        return true;
+    }
+
+    if (!buildIndex(fname, format, index)) { return false; }
+    writeIndex(idx_fname, *index);
+    return true;
+}
+
+bool seekEvent(std::istream *is, const EventIndex &index, std::size_t i) {
+    if (i >= index.size()) { return false; }
+    is->clear();
+    is->seekg(static_cast<std::streamoff>(index.offset(i)));
+    return !is->fail();
+}
+}  // namespace colevent
@@ -0,0 +1,98 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_COLEVENT_EVENT_INDEX_H_
+#define COLEVENT_SRC_COLEVENT_EVENT_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace colevent {
+enum class EventFormat { LHEF = 0, LHCO = 1 };
+
+// The byte offsets of the events in a file: the `<event` tags of LHEF or the
+// event header lines (starting with `0`) of LHCO. Event `i` occupies the bytes
+// [offset(i), endOffset(i)) of the file. The size, the modification time and
+// the checksum of the file are kept to detect a stale index.
+class EventIndex {
+private:
+    EventFormat format_ = EventFormat::LHEF;
+    std::uint64_t source_size_ = 0;
+    std::int64_t source_mtime_ = 0;
+    std::uint64_t checksum_ = 0;
+    std::vector<std::uint64_t> offsets_;
+
+public:
+    using EventRange = std::pair<std::size_t, std::size_t>;
+
+    EventIndex() {}
+    EventIndex(EventFormat format, std::uint64_t source_size,
+               std::uint64_t checksum, std::vector<std::uint64_t> offsets)
+        : format_(format),
+          source_size_(source_size),
+          checksum_(checksum),
+          offsets_(std::move(offsets)) {}
+
+    EventFormat format() const { return format_; }
+    std::uint64_t sourceSize() const { return source_size_; }
+    // Nanoseconds since the epoch, or 0 if the index is not built from a file.
+    std::int64_t sourceMTime() const { return source_mtime_; }
+    void setSourceMTime(std::int64_t mtime) { source_mtime_ = mtime; }
+    std::uint64_t checksum() const { return checksum_; }
+    const std::vector<std::uint64_t> &offsets() const { return offsets_; }
+
+    std::size_t size() const { return offsets_.size(); }
+    bool empty() const { return offsets_.empty(); }
+
+    std::uint64_t offset(std::size_t i) const { return offsets_[i]; }
+    std::uint64_t endOffset(std::size_t i) const {
+        return i + 1 < offsets_.size() ? offsets_[i + 1] : source_size_;
+    }
+
+    // Splits the events into at most `k` contiguous ranges [i, j) of nearly
+    // equal size in bytes. Empty ranges are not returned.
+    std::vector<EventRange> shards(std::size_t k) const;
+};
+
+// 64-bit checksum of the bytes in [first, last). It is not cryptographic.
+std::uint64_t checksum(const char *first, const char *last);
+
+EventIndex buildIndex(const char *first, const char *last, EventFormat format);
+
+// Returns false if the file cannot be opened.
+bool buildIndex(const std::string &fname, EventFormat format,
+                EventIndex *index);
+
+// The name of the sidecar index file, e.g., `events.lhe.idx`.
+inline std::string indexFileName(const std::string &fname) {
+    return fname + ".idx";
+}
+
+// Reads and writes an index in the binary format of the sidecar files. They
+// return false on I/O errors or if the file is not a valid index.
+bool readIndex(const std::string &idx_fname, EventIndex *index);
+
+bool writeIndex(const std::string &idx_fname, const EventIndex &index);
+
+// Checks that `index` has been built from the file `fname` by comparing the
+// size and the modification time of the file. The checksum is also compared
+// if `verify_checksum` is true, which reads the whole file.
+bool isIndexOf(const EventIndex &index, const std::string &fname,
+               bool verify_checksum = false);
+
+// Reads the sidecar index of `fname` if it is up to date. Otherwise, the
+// index is built and written to the sidecar file. Failing to write the
+// sidecar file is not an error. Returns false if `fname` cannot be read. See
+// `isIndexOf` for `verify_checksum`.
+bool loadIndex(const std::string &fname, EventFormat format, EventIndex *index,
+               bool verify_checksum = false);
+
+// Moves the stream to the beginning of the `i`-th event. The following
+// `lhef::parseEvent` or `lhco::parseEvent` reads that event.
+bool seekEvent(std::istream *is, const EventIndex &index, std::size_t i);
+}  // namespace colevent
+
+#endif  // COLEVENT_SRC_COLEVENT_EVENT_INDEX_H_
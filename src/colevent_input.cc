@@ -0,0 +1,402 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "colevent_input.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif  // HAVE_CONFIG_H
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif  // HAVE_ZLIB
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif  // HAVE_ZSTD
+#ifdef HAVE_LZMA
+#include <lzma.h>
+#endif  // HAVE_LZMA
+
+namespace colevent {
+Compression detectCompression(const unsigned char *magic, std::size_t n) {
+    const unsigned char gzip[] = {0x1f, 0x8b};
+    const unsigned char zstd[] = {0x28, 0xb5, 0x2f, 0xfd};
+    const unsigned char xz[] = {0xfd, 0x37, 0x7a, 0x58, 0x5a, 0x00};
+    if (n >= sizeof(gzip) && std::memcmp(magic, gzip, sizeof(gzip)) == 0) {
+        return Compression::Gzip;
+    }
+    if (n >= sizeof(zstd) && std::memcmp(magic, zstd, sizeof(zstd)) == 0) {
+        return Compression::Zstd;
+    }
+    if (n >= sizeof(xz) && std::memcmp(magic, xz, sizeof(xz)) == 0) {
+        return Compression::Xz;
+    }
+    return Compression::None;
+}
+
+std::string show(const Compression &c) {
+    switch (c) {
+    case Compression::Gzip:
+        return "gzip";
+    case Compression::Zstd:
+        return "zstd";
+    case Compression::Xz:
+        return "xz";
+    default:
+        return "none";
+    }
+}
+
+bool isSupported(const Compression &c) {
+    switch (c) {
+    case Compression::None:
+        return true;
+#ifdef HAVE_ZLIB
+    case Compression::Gzip:
+        return true;
+#endif  // HAVE_ZLIB
+#ifdef HAVE_ZSTD
+    case Compression::Zstd:
+        return true;
+#endif  // HAVE_ZSTD
+#ifdef HAVE_LZMA
+    case Compression::Xz:
+        return true;
+#endif  // HAVE_LZMA
+    default:
+        return false;
+    }
+}
+
+// Reads a file and decodes its contents block by block.
+class Decoder {
+protected:
+    std::FILE *file_;
+    std::size_t compressed_bytes_ = 0;
+    bool error_ = false;
+
+    std::size_t read(void *buf, std::size_t size) {
+        const std::size_t n = std::fread(buf, 1, size, file_);
+        compressed_bytes_ += n;
+        return n;
+    }
+
+public:
+    explicit Decoder(std::FILE *file) : file_(file) {}
+    virtual ~Decoder() { std::fclose(file_); }
+
+    Decoder(const Decoder &) = delete;
+    Decoder &operator=(const Decoder &) = delete;
+
+    // Writes up to `size` decoded bytes to `out` and returns their number.
+    // It returns 0 only at the end of the data or on an error.
+    virtual std::size_t decode(char *out, std::size_t size) = 0;
+
+    std::size_t compressed_bytes() const { return compressed_bytes_; }
+    bool error() const { return error_; }
+};
+
+// The plain data are read directly into the blocks of the reader.
+class PlainDecoder : public Decoder {
+public:
+    explicit PlainDecoder(std::FILE *file) : Decoder(file) {}
+
+    std::size_t decode(char *out, std::size_t size) { return read(out, size); }
+};
+
+// The compressed data are read into a buffer of their own before decoding.
+class CompressedDecoder : public Decoder {
+protected:
+    std::vector<unsigned char> in_;
+
+    std::size_t readInput() { return read(in_.data(), in_.size()); }
+
+public:
+    explicit CompressedDecoder(std::FILE *file)
+        : Decoder(file), in_(std::size_t(1) << 18) {}
+};
+
+#ifdef HAVE_ZLIB
+class GzipDecoder : public CompressedDecoder {
+private:
+    z_stream zs_;
+    bool in_member_ = false;
+    bool end_ = false;
+
+public:
+    explicit GzipDecoder(std::FILE *file) : CompressedDecoder(file) {
+        std::memset(&zs_, 0, sizeof(zs_));
+        // 32: detect the gzip or zlib header automatically.
+        error_ = inflateInit2(&zs_, 15 + 32) != Z_OK;
+        end_ = error_;
+    }
+    ~GzipDecoder() { inflateEnd(&zs_); }
+
+    std::size_t decode(char *out, std::size_t size) {
+        zs_.next_out = reinterpret_cast<Bytef *>(out);
+        zs_.avail_out = static_cast<uInt>(size);
+        while (zs_.avail_out > 0 && !end_) {
+            if (zs_.avail_in == 0) {
+                const std::size_t n = readInput();
+                if (n == 0) {
+                    error_ = in_member_;  // truncated
+                    end_ = true;
+                    break;
+                }
+                zs_.next_in = in_.data();
+                zs_.avail_in = static_cast<uInt>(n);
+            }
+            in_member_ = true;
+            const int ret = inflate(&zs_, Z_NO_FLUSH);
+            if (ret == Z_STREAM_END) {  // there may be more gzip members
+                inflateReset(&zs_);
+                in_member_ = false;
+            } else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+                error_ = end_ = true;
+            }
+        }
+        return size - zs_.avail_out;
+    }
+};
+#endif  // HAVE_ZLIB
+
+#ifdef HAVE_ZSTD
+class ZstdDecoder : public CompressedDecoder {
+private:
+    ZSTD_DStream *ds_;
+    ZSTD_inBuffer input_ = {nullptr, 0, 0};
+    std::size_t hint_ = 0;  // nonzero while a frame is not complete
+    bool end_ = false;
+
+public:
+    explicit ZstdDecoder(std::FILE *file)
+        : CompressedDecoder(file), ds_(ZSTD_createDStream()) {
+        error_ = ds_ == nullptr || ZSTD_isError(ZSTD_initDStream(ds_));
+        end_ = error_;
+    }
+    ~ZstdDecoder() { ZSTD_freeDStream(ds_); }
+
+    std::size_t decode(char *out, std::size_t size) {
+        ZSTD_outBuffer output = {out, size, 0};
+        while (output.pos < output.size && !end_) {
+            if (input_.pos == input_.size) {
+                const std::size_t n = readInput();
+                if (n == 0) {
+                    error_ = hint_ != 0;  // truncated
+                    end_ = true;
+                    break;
+                }
+                input_ = {in_.data(), n, 0};
+            }
+            hint_ = ZSTD_decompressStream(ds_, &output, &input_);
+            if (ZSTD_isError(hint_)) { error_ = end_ = true; }
+        }
+        return output.pos;
+    }
+};
+#endif  // HAVE_ZSTD
+
+#ifdef HAVE_LZMA
+class XzDecoder : public CompressedDecoder {
+private:
+    lzma_stream strm_ = LZMA_STREAM_INIT;
+    lzma_action action_ = LZMA_RUN;
+    bool end_ = false;
+
+public:
+    explicit XzDecoder(std::FILE *file) : CompressedDecoder(file) {
+        error_ = lzma_stream_decoder(&strm_, UINT64_MAX, LZMA_CONCATENATED) !=
+                 LZMA_OK;
+        end_ = error_;
+    }
+    ~XzDecoder() { lzma_end(&strm_); }
+
+    std::size_t decode(char *out, std::size_t size) {
+        strm_.next_out = reinterpret_cast<uint8_t *>(out);
+        strm_.avail_out = size;
+        while (strm_.avail_out > 0 && !end_) {
+            if (strm_.avail_in == 0 && action_ == LZMA_RUN) {
+                const std::size_t n = readInput();
+                strm_.next_in = in_.data();
+                strm_.avail_in = n;
+                if (n == 0) { action_ = LZMA_FINISH; }
+            }
+            const lzma_ret ret = lzma_code(&strm_, action_);
+            if (ret == LZMA_STREAM_END) {
+                end_ = true;
+            } else if (ret != LZMA_OK) {
+                error_ = end_ = true;
+            }
+        }
+        return size - strm_.avail_out;
+    }
+};
+#endif  // HAVE_LZMA
+
+// A ring of blocks filled by the decoder on a background thread. The reader
+// takes the blocks in turn as the get area of the stream buffer, so that the
+// decoded data are not copied again.
+class DecompressingBuffer : public std::streambuf {
+private:
+    struct Block {
+        std::vector<char> data;
+        std::size_t size = 0;
+        bool filled = false;
+    };
+
+    std::unique_ptr<Decoder> decoder_;
+    std::vector<Block> blocks_;
+    std::size_t read_index_ = 0;
+    bool holding_ = false;  // whether the reader holds blocks_[read_index_]
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    bool done_ = false;
+    bool stop_ = false;
+    InputStats stats_;
+    std::thread producer_;
+
+public:
+    explicit DecompressingBuffer(std::unique_ptr<Decoder> decoder,
+                                 std::size_t num_blocks = 8,
+                                 std::size_t block_size = std::size_t(1) << 20)
+        : decoder_(std::move(decoder)), blocks_(num_blocks) {
+        for (auto &b : blocks_) { b.data.resize(block_size); }
+        producer_ = std::thread([this] { produce(); });
+    }
+
+    ~DecompressingBuffer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cond_.notify_all();
+        producer_.join();
+    }
+
+    InputStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+protected:
+    int_type underflow() {
+        if (gptr() < egptr()) { return traits_type::to_int_type(*gptr()); }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (holding_) {  // give the consumed block back to the producer
+            blocks_[read_index_].filled = false;
+            read_index_ = (read_index_ + 1) % blocks_.size();
+            holding_ = false;
+            cond_.notify_all();
+        }
+
+        Block &block = blocks_[read_index_];
+        if (!block.filled && !done_) {
+            const auto start = std::chrono::steady_clock::now();
+            cond_.wait(lock, [this, &block] { return block.filled || done_; });
+            const std::chrono::duration<double> waited =
+                std::chrono::steady_clock::now() - start;
+            stats_.wait_seconds += waited.count();
+        }
+        if (!block.filled) { return traits_type::eof(); }
+
+        holding_ = true;
+        setg(block.data.data(), block.data.data(),
+             block.data.data() + block.size);
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    void produce() {
+        for (std::size_t index = 0;; index = (index + 1) % blocks_.size()) {
+            Block &block = blocks_[index];
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cond_.wait(lock,
+                           [this, &block] { return stop_ || !block.filled; });
+                if (stop_) { return; }
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            const std::size_t n =
+                decoder_->decode(block.data.data(), block.data.size());
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            stats_.decompress_seconds += elapsed.count();
+            stats_.compressed_bytes = decoder_->compressed_bytes();
+            stats_.decompressed_bytes += n;
+            stats_.error = decoder_->error();
+            if (n == 0) {
+                done_ = true;
+            } else {
+                block.size = n;
+                block.filled = true;
+            }
+            cond_.notify_all();
+            if (done_) { return; }
+        }
+    }
+};
+
+InputStream::InputStream(std::unique_ptr<DecompressingBuffer> buf,
+                         Compression c)
+    : std::istream(buf.get()), buf_(std::move(buf)), compression_(c) {
+    if (!buf_) { setstate(std::ios_base::failbit); }
+}
+
+InputStream::~InputStream() {}
+
+InputStats InputStream::stats() const {
+    return buf_ ? buf_->stats() : InputStats();
+}
+
+std::unique_ptr<Decoder> mkDecoder(std::FILE *file, Compression c) {
+    switch (c) {
+    case Compression::None:
+        return std::make_unique<PlainDecoder>(file);
+#ifdef HAVE_ZLIB
+    case Compression::Gzip:
+        return std::make_unique<GzipDecoder>(file);
+#endif  // HAVE_ZLIB
+#ifdef HAVE_ZSTD
+    case Compression::Zstd:
+        return std::make_unique<ZstdDecoder>(file);
+#endif  // HAVE_ZSTD
+#ifdef HAVE_LZMA
+    case Compression::Xz:
+        return std::make_unique<XzDecoder>(file);
+#endif  // HAVE_LZMA
+    default:
+        std::fclose(file);
+        return nullptr;
+    }
+}
+
+std::unique_ptr<InputStream> openInput(const std::string &fname) {
+    std::FILE *file = std::fopen(fname.c_str(), "rb");
+    if (file == nullptr) {
+        return std::make_unique<InputStream>(nullptr, Compression::None);
+    }
+
+    unsigned char magic[6];
+    const std::size_t n = std::fread(magic, 1, sizeof(magic), file);
+    std::rewind(file);
+    const Compression c = detectCompression(magic, n);
+
+    auto decoder = mkDecoder(file, c);
+    if (!decoder) { return std::make_unique<InputStream>(nullptr, c); }
+    return std::make_unique<InputStream>(
+        std::make_unique<DecompressingBuffer>(std::move(decoder)), c);
+}
+}  // namespace colevent
@@ -0,0 +1,60 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_COLEVENT_INPUT_H_
+#define COLEVENT_SRC_COLEVENT_INPUT_H_
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+
+namespace colevent {
+enum class Compression { None, Gzip, Zstd, Xz };
+
+// Detects the compression format from the first bytes of a file.
+Compression detectCompression(const unsigned char *magic, std::size_t n);
+
+std::string show(const Compression &c);
+
+// Whether the library has been built with the decompressor for `c`.
+bool isSupported(const Compression &c);
+
+struct InputStats {
+    // Bytes read from the file.
+    std::size_t compressed_bytes = 0;
+    // Bytes handed to the reader after the decompression.
+    std::size_t decompressed_bytes = 0;
+    // Time spent by the background thread reading and decompressing.
+    double decompress_seconds = 0.0;
+    // Time the reader waited for the background thread. It stays close to
+    // zero as long as the decompression is faster than the parsing.
+    double wait_seconds = 0.0;
+    // Whether the decompression has failed on corrupted data.
+    bool error = false;
+};
+
+class DecompressingBuffer;
+
+// An input stream whose data are read and decompressed on a background
+// thread into a ring of buffers. It can be passed to `lhef::parseEvent` and
+// `lhco::parseEvent` like `std::ifstream`.
+class InputStream : public std::istream {
+private:
+    std::unique_ptr<DecompressingBuffer> buf_;
+    Compression compression_;
+
+public:
+    InputStream(std::unique_ptr<DecompressingBuffer> buf, Compression c);
+    ~InputStream();
+
+    Compression compression() const { return compression_; }
+    InputStats stats() const;
+};
+
+// Opens a plain, gzip, zstd or xz file, detecting the format from its magic
+// bytes. If the file cannot be opened or the library has been built without
+// the decompressor for its format, the failbit of the stream is set.
+std::unique_ptr<InputStream> openInput(const std::string &fname);
+}  // namespace colevent
+
+#endif  // COLEVENT_SRC_COLEVENT_INPUT_H_
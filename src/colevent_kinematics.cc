@@ -2,6 +2,8 @@
 
 #include "colevent_kinematics.h"
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <string>
 #include "colevent_constants.h"
 #ifdef HAVE_CONFIG_H
@@ -24,18 +26,32 @@ std::string show(const FourMomentum &p) {
     return str;
 }
 
+bool setKinematicsBackend(KinematicsBackend backend) {
+#ifndef HAVE_ROOT
+    if (backend == KinematicsBackend::ROOT) { return false; }
+#endif  // HAVE_ROOT
+    detail::use_root_kinematics.store(backend == KinematicsBackend::ROOT,
+                                      std::memory_order_relaxed);
+    return true;
+}
+
+std::string show(KinematicsBackend backend) {
+    return backend == KinematicsBackend::ROOT ? "ROOT" : "native";
+}
+
+namespace detail {
 #ifdef HAVE_ROOT
 
 TVector3 mkTVector3(const Px &px, const Py &py, const Pz &pz) {
     return {px.value, py.value, pz.value};
 }
 
-double cosTheta(const Px &px, const Py &py, const Pz &pz) {
+double rootCosTheta(const Px &px, const Py &py, const Pz &pz) {
     TVector3 v{mkTVector3(px, py, pz)};
     return v.CosTheta();
 }
 
-double pseudoRapidity(const Px &px, const Py &py, const Pz &pz) {
+double rootPseudoRapidity(const Px &px, const Py &py, const Pz &pz) {
     TVector3 v{mkTVector3(px, py, pz)};
     return v.PseudoRapidity();
 }
@@ -44,53 +60,47 @@ TLorentzVector mkLorentzVector(const FourMomentum &p) {
     return {p.px(), p.py(), p.pz(), p.energy()};
 }
 
-double deltaPhi(const FourMomentum &p1, const FourMomentum &p2) {
+double rootDeltaPhi(const FourMomentum &p1, const FourMomentum &p2) {
     TLorentzVector v1 = mkLorentzVector(p1), v2 = mkLorentzVector(p2);
     return v1.DeltaPhi(v2);
 }
 
-double deltaR(const FourMomentum &p1, const FourMomentum &p2) {
+double rootDeltaR(const FourMomentum &p1, const FourMomentum &p2) {
     TLorentzVector v1 = mkLorentzVector(p1), v2 = mkLorentzVector(p2);
     return v1.DeltaR(v2);
 }
 
 #else  // HAVE_ROOT
 
-double cosTheta(const Px &px, const Py &py, const Pz &pz) {
-    double ptot = std::sqrt(px.value * px.value + py.value * py.value +
-                            pz.value * pz.value);
-    return ptot == 0 ? 1 : pz.value / ptot;
+namespace {
+// The ROOT backend cannot be selected without ROOT, so reaching the functions
+// below is a bug. They abort rather than return a wrong value.
+[[noreturn]] void noRoot(const char *func) {
+    std::fprintf(stderr, "colevent: %s called, but built without ROOT.\n",
+                 func);
+    std::abort();
 }
+}  // namespace
 
-double pseudoRapidity(const Px &px, const Py &py, const Pz &pz) {
-    double costh = cosTheta(px, py, pz);
-    if (costh * costh < 1) {
-        return -0.5 * std::log((1.0 - costh) / (1.0 + costh));
-    }
-    if (pz.value == 0) {
-        return 10e10;
-    } else {
-        return -10e10;
-    }
+double rootCosTheta(const Px &, const Py &, const Pz &) {
+    noRoot("rootCosTheta");
 }
 
-double mPi2Pi(double x) {
-    const double TWOPI = 2.0 * PI;
-    while (x >= PI) { x -= TWOPI; }
-    while (x < -PI) { x += TWOPI; }
-    return x;
+double rootPseudoRapidity(const Px &, const Py &, const Pz &) {
+    noRoot("rootPseudoRapidity");
 }
 
-double deltaPhi(const FourMomentum &p1, const FourMomentum &p2) {
-    return mPi2Pi(p1.phi() - p2.phi());
+double rootDeltaPhi(const FourMomentum &, const FourMomentum &) {
+    noRoot("rootDeltaPhi");
 }
 
-double deltaR(const FourMomentum &p1, const FourMomentum &p2) {
-    double deta = p1.eta() - p2.eta();
-    double dphi = deltaPhi(p1, p2);
-    return std::hypot(deta, dphi);
+double rootDeltaR(const FourMomentum &, const FourMomentum &) {
+    noRoot("rootDeltaR");
 }
 
+#endif  // HAVE_ROOT
+}  // namespace detail
+
 void CM22::p_init() {
     const double d = 2.0 * std::sqrt(s_);
     p_in_ = lambda12(s_, m_in1_sq_, m_in2_sq_) / d;
@@ -118,6 +128,4 @@ FourMomentum CM22::k2() const {
     return {Energy(e), Px(-p_out_ * sinth_ * std::cos(phi_)),
             Py(-p_out_ * sinth_ * std::sin(phi_)), Pz(-p_out_ * costh_)};
 }
-
-#endif  // HAVE_ROOT
 }  // namespace colevent
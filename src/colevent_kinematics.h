@@ -4,6 +4,7 @@
 #define COLEVENT_SRC_COLEVENT_KINEMATICS_H_
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <string>
 #include "colevent_constants.h"
@@ -37,9 +38,64 @@ struct Energy {
     Energy operator-() const { return Energy{-value}; }
 };
 
-double cosTheta(const Px &px, const Py &py, const Pz &pz);
+// The implementations of `cosTheta`, `pseudoRapidity`, `deltaPhi` and
+// `deltaR`. `Native` is the default, inlined from this header. `ROOT` calls
+// `TVector3` and `TLorentzVector` instead, to cross-check the results, and
+// is available only if the library is built with ROOT.
+enum class KinematicsBackend { Native, ROOT };
 
-double pseudoRapidity(const Px &px, const Py &py, const Pz &pz);
+// Returns false, keeping the backend, if `backend` is not available.
+bool setKinematicsBackend(KinematicsBackend backend);
+
+std::string show(KinematicsBackend backend);
+
+namespace detail {
+inline std::atomic<bool> use_root_kinematics{false};
+
+inline bool useRootKinematics() {
+    return __builtin_expect(
+        use_root_kinematics.load(std::memory_order_relaxed), 0);
+}
+
+double rootCosTheta(const Px &px, const Py &py, const Pz &pz);
+double rootPseudoRapidity(const Px &px, const Py &py, const Pz &pz);
+}  // namespace detail
+
+inline KinematicsBackend kinematicsBackend() {
+    return detail::useRootKinematics() ? KinematicsBackend::ROOT
+                                       : KinematicsBackend::Native;
+}
+
+inline double cosTheta(const Px &px, const Py &py, const Pz &pz) {
+    if (detail::useRootKinematics()) {
+        return detail::rootCosTheta(px, py, pz);
+    }
+    double ptot = std::sqrt(px.value * px.value + py.value * py.value +
+                            pz.value * pz.value);
+    return ptot == 0 ? 1 : pz.value / ptot;
+}
+
+inline double pseudoRapidity(const Px &px, const Py &py, const Pz &pz) {
+    if (detail::useRootKinematics()) {
+        return detail::rootPseudoRapidity(px, py, pz);
+    }
+    double costh = cosTheta(px, py, pz);
+    if (costh * costh < 1) {
+        return -0.5 * std::log((1.0 - costh) / (1.0 + costh));
+    }
+    if (pz.value == 0) {
+        return 10e10;
+    } else {
+        return -10e10;
+    }
+}
+
+// x wrapped into [-pi, pi).
+inline double mPi2Pi(double x) {
+    while (x >= PI) { x -= TWOPI; }
+    while (x < -PI) { x += TWOPI; }
+    return x;
+}
 
 struct Pt {
     double value;
@@ -101,6 +157,9 @@ public:
         double m2 = mass2();
         return m2 < 0 ? -std::sqrt(-m2) : std::sqrt(m2);
     }
+    double rapidity() const {
+        return 0.5 * std::log((e_.value + pz_.value) / (e_.value - pz_.value));
+    }
 
     FourMomentum operator-() const { return {-e_, -px_, -py_, -pz_}; }
 
@@ -135,9 +194,22 @@ public:
 
 std::string show(const FourMomentum &p);
 
-double deltaPhi(const FourMomentum &p1, const FourMomentum &p2);
+namespace detail {
+double rootDeltaPhi(const FourMomentum &p1, const FourMomentum &p2);
+double rootDeltaR(const FourMomentum &p1, const FourMomentum &p2);
+}  // namespace detail
 
-double deltaR(const FourMomentum &p1, const FourMomentum &p2);
+inline double deltaPhi(const FourMomentum &p1, const FourMomentum &p2) {
+    if (detail::useRootKinematics()) { return detail::rootDeltaPhi(p1, p2); }
+    return mPi2Pi(p1.phi() - p2.phi());
+}
+
+inline double deltaR(const FourMomentum &p1, const FourMomentum &p2) {
+    if (detail::useRootKinematics()) { return detail::rootDeltaR(p1, p2); }
+    double deta = p1.eta() - p2.eta();
+    double dphi = deltaPhi(p1, p2);
+    return std::hypot(deta, dphi);
+}
 
 inline double lambda12(const double x, const double y, const double z) {
     double lambda = x * x + y * y + z * z - 2 * x * y - 2 * y * z - 2 * z * x;
@@ -0,0 +1,64 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "colevent_mapped_file.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string>
+#include <utility>
+
+namespace colevent {
+MappedFile::MappedFile(const std::string &fname) {
+    const int fd = ::open(fname.c_str(), O_RDONLY);
+    if (fd < 0) { return; }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return;
+    }
+
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_ > 0) {
+        void *addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            size_ = 0;
+            ::close(fd);
+            return;
+        }
+        ::madvise(addr, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char *>(addr);
+    }
+    ::close(fd);  // the mapping stays valid after closing the descriptor.
+    open_ = true;
+}
+
+MappedFile::~MappedFile() { unmap(); }
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : data_(other.data_), size_(other.size_), open_(other.open_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.open_ = false;
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        unmap();
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(open_, other.open_);
+    }
+    return *this;
+}
+
+void MappedFile::unmap() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<char *>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    open_ = false;
+}
+}  // namespace colevent
@@ -0,0 +1,38 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_COLEVENT_MAPPED_FILE_H_
+#define COLEVENT_SRC_COLEVENT_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace colevent {
+// Read-only memory mapping of a whole file. The mapping is released when the
+// object is destroyed.
+class MappedFile {
+private:
+    const char *data_ = nullptr;
+    std::size_t size_ = 0;
+    bool open_ = false;
+
+public:
+    MappedFile() {}
+    explicit MappedFile(const std::string &fname);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    bool is_open() const { return open_; }
+    const char *begin() const { return data_; }
+    const char *end() const { return data_ + size_; }
+    std::size_t size() const { return size_; }
+
+private:
+    void unmap();
+};
+}  // namespace colevent
+
+#endif  // COLEVENT_SRC_COLEVENT_MAPPED_FILE_H_
@@ -0,0 +1,125 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "colevent_mt2.h"
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <vector>
+#include "colevent_kinematics.h"
+#include "colevent_simd.h"
+#include "colevent_simd_ops.h"
+#include "colevent_thread_pool.h"
+#include "lester_mt2_bisect.h"
+
+namespace colevent {
+void MT2Columns::clear() {
+    for (auto *v : {&m_vis1, &px_vis1, &py_vis1, &m_vis2, &px_vis2, &py_vis2,
+                    &px_miss, &py_miss}) {
+        v->clear();
+    }
+}
+
+void MT2Columns::reserve(std::size_t n) {
+    for (auto *v : {&m_vis1, &px_vis1, &py_vis1, &m_vis2, &px_vis2, &py_vis2,
+                    &px_miss, &py_miss}) {
+        v->reserve(n);
+    }
+}
+
+void MT2Columns::add(const FourMomentum &vis1, const FourMomentum &vis2,
+                     double px_miss_value, double py_miss_value) {
+    m_vis1.push_back(vis1.mass());
+    px_vis1.push_back(vis1.px());
+    py_vis1.push_back(vis1.py());
+    m_vis2.push_back(vis2.mass());
+    px_vis2.push_back(vis2.px());
+    py_vis2.push_back(vis2.py());
+    px_miss.push_back(px_miss_value);
+    py_miss.push_back(py_miss_value);
+}
+
+double mT2(double m_vis1, double px_vis1, double py_vis1, double m_vis2,
+           double px_vis2, double py_vis2, double px_miss, double py_miss,
+           double m_inv1, double m_inv2, double precision) {
+    return asymm_mt2_lester_bisect::get_mT2(m_vis1, px_vis1, py_vis1, m_vis2,
+                                            px_vis2, py_vis2, px_miss, py_miss,
+                                            m_inv1, m_inv2, precision);
+}
+
+namespace {
+// The rows [first, last) of the matrix. The hypotheses are the inner loop, so
+// that the momenta of an event are loaded once.
+void mT2RowsScalar(const MT2Columns &events,
+                   const std::vector<MT2Hypothesis> &hypotheses,
+                   double precision, std::size_t first, std::size_t last,
+                   double *mt2) {
+    const std::size_t h = hypotheses.size();
+    for (std::size_t i = first; i < last; ++i) {
+        for (std::size_t k = 0; k < h; ++k) {
+            mt2[i * h + k] =
+                mT2(events.m_vis1[i], events.px_vis1[i], events.py_vis1[i],
+                    events.m_vis2[i], events.px_vis2[i], events.py_vis2[i],
+                    events.px_miss[i], events.py_miss[i],
+                    hypotheses[k].m_inv1, hypotheses[k].m_inv2, precision);
+        }
+    }
+}
+
+// The vectorized kernels bisect `V::size` events at once for a hypothesis,
+// with the same operations as `asymm_mt2_lester_bisect::get_mT2`.
+void mT2Rows(const MT2Columns &events,
+             const std::vector<MT2Hypothesis> &hypotheses, double precision,
+             std::size_t first, std::size_t last, double *mt2) {
+    const std::size_t h = hypotheses.size();
+    switch (simdLevel()) {
+#ifdef COLEVENT_X86_SIMD
+    case SimdLevel::AVX512:
+        for (std::size_t k = 0; k < h; ++k) {
+            simd::avx512::mT2Events(events, first, last, hypotheses[k],
+                                    precision, mt2 + k, h);
+        }
+        return;
+    case SimdLevel::AVX2:
+        for (std::size_t k = 0; k < h; ++k) {
+            simd::avx2::mT2Events(events, first, last, hypotheses[k],
+                                  precision, mt2 + k, h);
+        }
+        return;
+#endif  // COLEVENT_X86_SIMD
+    default:
+        return mT2RowsScalar(events, hypotheses, precision, first, last, mt2);
+    }
+}
+}  // namespace
+
+void mT2Matrix(const MT2Columns &events,
+               const std::vector<MT2Hypothesis> &hypotheses,
+               std::vector<double> *mt2, const MT2Options &opts) {
+    const std::size_t n = events.size();
+    mt2->resize(n * hypotheses.size());
+    if (mt2->empty()) { return; }
+
+    // The message is printed, or disabled, here rather than by the first of
+    // the worker threads.
+    asymm_mt2_lester_bisect::disableCopyrightMessage(opts.print_copyright);
+
+    const std::size_t chunk_size = std::max<std::size_t>(opts.chunk_size, 1);
+    if (opts.num_threads == 1 || n <= chunk_size) {
+        mT2Rows(events, hypotheses, opts.precision, 0, n, mt2->data());
+        return;
+    }
+
+    ThreadPool pool(opts.num_threads);
+    std::vector<std::future<void>> results;
+    results.reserve((n + chunk_size - 1) / chunk_size);
+    for (std::size_t first = 0; first < n; first += chunk_size) {
+        const std::size_t last = std::min(n, first + chunk_size);
+        results.push_back(
+            pool.submit([&events, &hypotheses, &opts, first, last, mt2] {
+                mT2Rows(events, hypotheses, opts.precision, first, last,
+                        mt2->data());
+            }));
+    }
+    for (auto &r : results) { r.get(); }
+}
+}  // namespace colevent
@@ -0,0 +1,62 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_COLEVENT_MT2_H_
+#define COLEVENT_SRC_COLEVENT_MT2_H_
+
+#include <cstddef>
+#include <vector>
+#include "colevent_kinematics.h"
+
+namespace colevent {
+// The masses and the transverse momenta of the two visible systems, and the
+// missing transverse momentum, of many events as a structure of arrays.
+struct MT2Columns {
+    std::vector<double> m_vis1, px_vis1, py_vis1;
+    std::vector<double> m_vis2, px_vis2, py_vis2;
+    std::vector<double> px_miss, py_miss;
+
+    std::size_t size() const { return m_vis1.size(); }
+    void clear();
+    void reserve(std::size_t n);
+    void add(const FourMomentum &vis1, const FourMomentum &vis2,
+             double px_miss_value, double py_miss_value);
+};
+
+// The trial masses of the invisible particles on each side.
+struct MT2Hypothesis {
+    double m_inv1 = 0.0;
+    double m_inv2 = 0.0;
+};
+
+struct MT2Options {
+    // Number of threads. If it is 0, the number of hardware threads is used.
+    unsigned num_threads = 0;
+    // Number of events computed by each task.
+    std::size_t chunk_size = 1024;
+    // The absolute precision of MT2. If it is 0, MT2 is computed to the
+    // machine precision, as `asymm_mt2_lester_bisect::get_mT2` does.
+    double precision = 0.0;
+    // If false, the copyright message of the MT2 calculator is not printed.
+    bool print_copyright = true;
+};
+
+// The asymmetric MT2 of an event by the bisection of arXiv:1411.4312. It is
+// negative if the calculation fails. It is thread-safe.
+double mT2(double m_vis1, double px_vis1, double py_vis1, double m_vis2,
+           double px_vis2, double py_vis2, double px_miss, double py_miss,
+           double m_inv1, double m_inv2, double precision = 0.0);
+
+// The n x h matrix of MT2 of the n events for the h hypotheses, stored event
+// by event: the element (i, k) is at i * h + k. The chunks of events are
+// computed on a thread pool. With AVX2 or AVX-512, see `colevent::simdLevel`,
+// 4 or 8 events are bisected at once in the vector lanes, each until its own
+// interval is done. The operations are the same as those of `mT2`, so that
+// the values agree with it within `MT2Options::precision`, or within rounding
+// if it is 0, for any number of threads.
+void mT2Matrix(const MT2Columns &events,
+               const std::vector<MT2Hypothesis> &hypotheses,
+               std::vector<double> *mt2,
+               const MT2Options &opts = MT2Options());
+}  // namespace colevent
+
+#endif  // COLEVENT_SRC_COLEVENT_MT2_H_
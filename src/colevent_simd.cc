@@ -0,0 +1,85 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "colevent_simd.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include "colevent_batch_kinematics.h"
+#include "colevent_constants.h"
+#include "colevent_mt2.h"
+#include "colevent_simd_ops.h"
+
+#ifdef COLEVENT_X86_SIMD
+// The kernels for each instruction set. The floating-point operations are
+// not contracted into FMA, so that the kernels round as the scalar
+// functions where they do the same operations.
+namespace colevent {
+namespace simd {
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#pragma GCC optimize("fp-contract=off")
+namespace avx2 {
+using V = Double4;
+#include "colevent_simd_kernels.h"
+}  // namespace avx2
+#pragma GCC pop_options
+
+// GCC 12 warns that the unspecified source operands of the AVX-512
+// intrinsics, e.g., of `_mm512_sqrt_pd`, may be used uninitialized.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx2,fma")
+#pragma GCC optimize("fp-contract=off")
+namespace avx512 {
+using V = Double8;
+#include "colevent_simd_kernels.h"
+}  // namespace avx512
+#pragma GCC pop_options
+#pragma GCC diagnostic pop
+}  // namespace simd
+}  // namespace colevent
+#endif  // COLEVENT_X86_SIMD
+
+namespace colevent {
+SimdLevel supportedSimdLevel() {
+#ifdef COLEVENT_X86_SIMD
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) { return SimdLevel::AVX512; }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return SimdLevel::AVX2;
+        }
+        return SimdLevel::Scalar;
+    }();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif  // COLEVENT_X86_SIMD
+}
+
+std::atomic<SimdLevel> &currentSimdLevel() {
+    static std::atomic<SimdLevel> level{supportedSimdLevel()};
+    return level;
+}
+
+SimdLevel simdLevel() { return currentSimdLevel().load(); }
+
+void setSimdLevel(SimdLevel level) {
+    if (level > supportedSimdLevel()) { level = supportedSimdLevel(); }
+    currentSimdLevel().store(level);
+}
+
+std::string show(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::AVX2:
+        return "AVX2";
+    case SimdLevel::AVX512:
+        return "AVX-512";
+    default:
+        return "scalar";
+    }
+}
+}  // namespace colevent
@@ -0,0 +1,28 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_COLEVENT_SIMD_H_
+#define COLEVENT_SRC_COLEVENT_SIMD_H_
+
+#include <string>
+
+namespace colevent {
+// Instruction sets of the batch kernels, e.g., `colevent::computeKinematics`.
+// The kernels are compiled for all of them, and the widest one supported by
+// the CPU is chosen at run time. They are available with GCC on x86-64;
+// otherwise only `Scalar` is.
+enum class SimdLevel { Scalar, AVX2, AVX512 };
+
+// The widest instruction set supported by the compiler and the CPU.
+SimdLevel supportedSimdLevel();
+
+// The instruction set used by the batch kernels.
+SimdLevel simdLevel();
+
+// Selects the instruction set of the batch kernels, e.g., to compare them
+// with the scalar functions. It is lowered to `supportedSimdLevel()`.
+void setSimdLevel(SimdLevel level);
+
+std::string show(SimdLevel level);
+}  // namespace colevent
+
+#endif  // COLEVENT_SRC_COLEVENT_SIMD_H_
@@ -0,0 +1,373 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+// The batch kernels, written once for the vector type `V` of an instruction
+// set. This file has no include guard: `colevent_simd.cc` includes it once
+// per instruction set, in a namespace defining `V` and under the
+// `#pragma GCC target` of the set. See `colevent_simd_ops.h`.
+
+// Loads the first `n` values from `p`, all of them if `n` is `V::size`.
+inline V loadN(const double *p, std::size_t n) {
+    return n == V::size ? V::load(p) : V::loadPartial(p, n);
+}
+
+inline void storeN(V x, double *p, std::size_t n) {
+    if (n == V::size) {
+        x.store(p);
+    } else {
+        x.storePartial(p, n);
+    }
+}
+
+// The natural logarithm, as in fdlibm: x = 2^k (1 + f) with 1 + f in
+// [sqrt(1/2), sqrt(2)), and log(1 + f) = f - f^2 / 2 + s (f^2 / 2 + R(s^2)),
+// where s = f / (2 + f).
+inline V log(V x) {
+    constexpr double ln2_hi = 6.93147180369123816490e-01;
+    constexpr double ln2_lo = 1.90821492927058770002e-10;
+    constexpr double Lg1 = 6.666666666666735130e-01;
+    constexpr double Lg2 = 3.999999999940941908e-01;
+    constexpr double Lg3 = 2.857142874366239149e-01;
+    constexpr double Lg4 = 2.222219843214978396e-01;
+    constexpr double Lg5 = 1.818357216161805012e-01;
+    constexpr double Lg6 = 1.531383769920937332e-01;
+    constexpr double Lg7 = 1.479819860511658591e-01;
+
+    // Subnormal numbers are scaled to normal ones.
+    const auto subnormal = x < V(0x1p-1022);
+    V k;
+    const V m = splitExponent(select(subnormal, x * V(0x1p54), x), &k);
+    k = select(subnormal, k - V(54.0), k);
+
+    const V f = m - V(1.0);
+    const V hfsq = V(0.5) * f * f;
+    const V s = f / (V(2.0) + f);
+    const V z = s * s;
+    const V w = z * z;
+    const V t1 = w * fma(w, fma(w, V(Lg6), V(Lg4)), V(Lg2));
+    const V t2 = z * fma(w, fma(w, fma(w, V(Lg7), V(Lg5)), V(Lg3)), V(Lg1));
+    const V r = t2 + t1;
+    V y = s * (hfsq + r) + k * V(ln2_lo) - hfsq + f + k * V(ln2_hi);
+
+    constexpr double inf = __builtin_inf();
+    y = select(x == V(inf), x, y);
+    y = select(x == V(0.0), V(-inf), y);
+    return select(x >= V(0.0), y, V(__builtin_nan("")));  // x < 0 or NaN
+}
+
+// The arctangent of t in [0, 1], as in Cephes: atan(t) = pi/4 + atan(u)
+// with u = (t - 1) / (t + 1) for t > 0.66, and a rational approximation of
+// atan(u) / u - 1 in u^2.
+inline V atan01(V t) {
+    constexpr double P0 = -8.750608600031904122785e-01;
+    constexpr double P1 = -1.615753718733365076637e+01;
+    constexpr double P2 = -7.500855792314704667340e+01;
+    constexpr double P3 = -1.228866684490136173410e+02;
+    constexpr double P4 = -6.485021904942025371773e+01;
+    constexpr double Q0 = +2.485846490142306297962e+01;
+    constexpr double Q1 = +1.650270098316988542046e+02;
+    constexpr double Q2 = +4.328810604912902668951e+02;
+    constexpr double Q3 = +4.853903996359136964868e+02;
+    constexpr double Q4 = +1.945506571482613964425e+02;
+    constexpr double pio4 = 7.85398163397448309616e-01;
+    constexpr double morebits = 6.123233995736765886130e-17;  // pi/2 - PIO2
+
+    const auto reduced = t > V(0.66);
+    const V u = select(reduced, (t - V(1.0)) / (t + V(1.0)), t);
+    const V z = u * u;
+    const V p = fma(fma(fma(fma(V(P0), z, V(P1)), z, V(P2)), z, V(P3)), z,
+                    V(P4));
+    const V q =
+        fma(fma(fma(fma(z + V(Q0), z, V(Q1)), z, V(Q2)), z, V(Q3)), z, V(Q4));
+    const V a = fma(u, z * p / q, u);
+    return select(reduced, V(pio4) + (a + V(0.5 * morebits)), a);
+}
+
+// atan2(y, x), but 0 if both x and y are zero as `FourMomentum::phi()`.
+inline V atan2(V y, V x) {
+    constexpr double pio2 = 1.57079632679489661923e+00;
+    constexpr double pi = 3.14159265358979323846e+00;
+    constexpr double morebits = 6.123233995736765886130e-17;
+
+    const V ax = abs(x), ay = abs(y);
+    const V lo = min(ax, ay), hi = max(ax, ay);
+    V a = atan01(lo / hi);
+    a = select(ay > ax, V(pio2) + (V(morebits) - a), a);
+    a = select(x < V(0.0), V(pi) + (V(2.0 * morebits) - a), a);
+    a = copySign(a, y);
+    return select(hi == V(0.0), V(0.0), a);
+}
+
+void computeKinematics(const KinematicsArrays &arr) {
+    for (std::size_t i = 0; i < arr.size; i += V::size) {
+        const std::size_t n = std::min(V::size, arr.size - i);
+        const V px = loadN(arr.px + i, n), py = loadN(arr.py + i, n);
+        if (arr.pt != nullptr) {
+            storeN(sqrt(fma(px, px, py * py)), arr.pt + i, n);
+        }
+        if (arr.phi != nullptr) { storeN(atan2(py, px), arr.phi + i, n); }
+        if (arr.eta != nullptr) {
+            // The same operations as `colevent::pseudoRapidity`.
+            const V pz = loadN(arr.pz + i, n);
+            const V ptot = sqrt(px * px + py * py + pz * pz);
+            const V costh = select(ptot == V(0.0), V(1.0), pz / ptot);
+            const V eta = V(-0.5) * log((V(1.0) - costh) / (V(1.0) + costh));
+            storeN(select(costh * costh < V(1.0), eta,
+                          select(pz == V(0.0), V(10e10), V(-10e10))),
+                   arr.eta + i, n);
+        }
+        if (arr.mass == nullptr && arr.rapidity == nullptr) { continue; }
+        const V e = loadN(arr.energy + i, n), pz = loadN(arr.pz + i, n);
+        if (arr.mass != nullptr) {
+            const V m2 = e * e - px * px - py * py - pz * pz;
+            storeN(select(m2 < V(0.0), -sqrt(-m2), sqrt(m2)), arr.mass + i, n);
+        }
+        if (arr.rapidity != nullptr) {
+            storeN(V(0.5) * log((e + pz) / (e - pz)), arr.rapidity + i, n);
+        }
+    }
+}
+
+// x - 2 pi if x >= pi, and x + 2 pi if x < -pi, as `colevent::deltaPhi`
+// for |x| < 3 pi.
+inline V wrapPhi(V x) {
+    x = select(x >= V(PI), x - V(TWOPI), x);
+    return select(x < V(-PI), x + V(TWOPI), x);
+}
+
+void deltaMatrices(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+                   double *dphi, double *dr) {
+    const std::size_t m = cols.size();
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const V eta(rows.eta[i]), phi(rows.phi[i]);
+        for (std::size_t j = 0; j < m; j += V::size) {
+            const std::size_t n = std::min(V::size, m - j);
+            const V dp = wrapPhi(phi - loadN(cols.phi.data() + j, n));
+            if (dphi != nullptr) { storeN(dp, dphi + i * m + j, n); }
+            if (dr != nullptr) {
+                const V de = eta - loadN(cols.eta.data() + j, n);
+                storeN(sqrt(fma(de, de, dp * dp)), dr + i * m + j, n);
+            }
+        }
+    }
+}
+
+void minDeltaR(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+               double *min_dr, int *closest) {
+    constexpr double inf = __builtin_inf();
+    const std::size_t m = cols.size();
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const V eta(rows.eta[i]), phi(rows.phi[i]);
+        // The smallest deltaR^2 and its column in each lane.
+        V best(inf), best_index(-1.0);
+        for (std::size_t j = 0; j < m; j += V::size) {
+            const std::size_t n = std::min(V::size, m - j);
+            const V index = V::lanes() + V(double(j));
+            const V dp = wrapPhi(phi - loadN(cols.phi.data() + j, n));
+            const V de = eta - loadN(cols.eta.data() + j, n);
+            const V dr2 = fma(de, de, dp * dp);
+            const auto closer = (dr2 < best) & (index < V(double(m)));
+            best = select(closer, dr2, best);
+            best_index = select(closer, index, best_index);
+        }
+        double lane_best[V::size], lane_index[V::size];
+        best.store(lane_best);
+        best_index.store(lane_index);
+        std::size_t k = 0;
+        for (std::size_t l = 1; l < V::size; ++l) {
+            if (lane_best[l] < lane_best[k] ||
+                (lane_best[l] == lane_best[k] &&
+                 lane_index[l] < lane_index[k])) {
+                k = l;
+            }
+        }
+        // sqrt is monotonic, so that this is the smallest deltaR.
+        min_dr[i] = std::sqrt(lane_best[k]);
+        if (closest != nullptr) {
+            closest[i] = static_cast<int>(lane_index[k]);
+        }
+    }
+}
+
+// The conic of the transverse momenta of an invisible particle for which a
+// parent of mass squared `mSq` has the visible mass squared `mtSq` and
+// momentum (tx, ty), as `asymm_mt2_lester_bisect::helper`, with the same
+// operations so that the results are the same.
+struct Ellipse {
+    V c_xx, c_yy, c_xy, c_x, c_y, c, det;
+};
+
+inline Ellipse ellipse(V mSq, V mtSq, V tx, V ty, V mqSq, V pxmiss,
+                       V pymiss) {
+    const V txSq = tx * tx;
+    const V tySq = ty * ty;
+    const V pxmissSq = pxmiss * pxmiss;
+    const V pymissSq = pymiss * pymiss;
+
+    Ellipse e;
+    e.c_xx = +4.0 * mtSq + 4.0 * tySq;
+    e.c_yy = +4.0 * mtSq + 4.0 * txSq;
+    e.c_xy = -4.0 * tx * ty;
+    e.c_x = -4.0 * mtSq * pxmiss - 2.0 * mqSq * tx + 2.0 * mSq * tx -
+            2.0 * mtSq * tx + 4.0 * pymiss * tx * ty - 4.0 * pxmiss * tySq;
+    e.c_y = -4.0 * mtSq * pymiss - 4.0 * pymiss * txSq - 2.0 * mqSq * ty +
+            2.0 * mSq * ty - 2.0 * mtSq * ty + 4.0 * pxmiss * tx * ty;
+    e.c = -mqSq * mqSq + 2 * mqSq * mSq - mSq * mSq + 2 * mqSq * mtSq +
+          2 * mSq * mtSq - mtSq * mtSq + 4.0 * mtSq * pxmissSq +
+          4.0 * mtSq * pymissSq + 4.0 * mqSq * pxmiss * tx -
+          4.0 * mSq * pxmiss * tx + 4.0 * mtSq * pxmiss * tx +
+          4.0 * mqSq * txSq + 4.0 * pymissSq * txSq + 4.0 * mqSq * pymiss * ty -
+          4.0 * mSq * pymiss * ty + 4.0 * mtSq * pymiss * ty -
+          8.0 * pxmiss * pymiss * tx * ty + 4.0 * mqSq * tySq +
+          4.0 * pxmissSq * tySq;
+    e.det = 2.0 * e.c_x * e.c_xy * e.c_y + e.c * e.c_xx * e.c_yy -
+            e.c_yy * e.c_x * e.c_x - e.c * e.c_xy * e.c_xy -
+            e.c_xx * e.c_y * e.c_y;
+    return e;
+}
+
+// `Lester::EllipseParams::lesterFactor`.
+inline V lesterFactor(const Ellipse &e1, const Ellipse &e2) {
+    return e1.c_xx * e1.c_yy * e2.c + 2.0 * e1.c_xy * e1.c_y * e2.c_x -
+           2.0 * e1.c_x * e1.c_yy * e2.c_x + e1.c * e1.c_yy * e2.c_xx -
+           2.0 * e1.c * e1.c_xy * e2.c_xy + 2.0 * e1.c_x * e1.c_y * e2.c_xy +
+           2.0 * e1.c_x * e1.c_xy * e2.c_y - 2.0 * e1.c_xx * e1.c_y * e2.c_y +
+           e1.c * e1.c_xx * e2.c_yy - e2.c_yy * (e1.c_x * e1.c_x) -
+           e2.c * (e1.c_xy * e1.c_xy) - e2.c_xx * (e1.c_y * e1.c_y);
+}
+
+// `Lester::ellipsesAreDisjoint`. The lanes where it throws, because the
+// ellipses are singular, are set in `*singular`.
+inline typename V::Mask ellipsesAreDisjoint(const Ellipse &e1,
+                                            const Ellipse &e2,
+                                            typename V::Mask *singular) {
+    const auto equal = (e1.c_xx == e2.c_xx) & (e1.c_yy == e2.c_yy) &
+                       (e1.c_xy == e2.c_xy) & (e1.c_x == e2.c_x) &
+                       (e1.c_y == e2.c_y) & (e1.c == e2.c);
+    const V p3 = e1.det, p2 = lesterFactor(e1, e2), p1 = lesterFactor(e2, e1),
+            p0 = e2.det;
+    // Divided by the larger of the leading and the constant coefficients.
+    const auto normal = abs(p3) >= abs(p0);
+    const V c3 = select(normal, p3, p0), c2 = select(normal, p2, p1),
+            c1 = select(normal, p1, p2), c0 = select(normal, p0, p3);
+    *singular = andNot(c3 == V(0.0), equal);
+
+    const V a = c2 / c3;
+    const V b = c1 / c3;
+    const V c = c0 / c3;
+    const V thing1 = -3.0 * b + a * a;
+    const V thing2 = -27.0 * c * c + 18.0 * c * a * b + a * a * b * b -
+                     4.0 * a * a * a * c - 4.0 * b * b * b;
+    const auto ans =
+        ((a >= V(0.0)) & (3.0 * a * c + b * a * a - 4.0 * b * b < V(0.0))) |
+        (a < V(0.0));
+    return andNot((thing1 > V(0.0)) & (thing2 > V(0.0)) & ans, equal);
+}
+
+// `asymm_mt2_lester_bisect::get_mT2` of the events [first, last) for a
+// hypothesis, with the deci-sections, bisecting the events in the lanes.
+// The result of the event i is stored at mt2[i * stride].
+void mT2Events(const MT2Columns &events, std::size_t first, std::size_t last,
+               const MT2Hypothesis &hypothesis, double precision, double *mt2,
+               std::size_t stride) {
+    using Mask = typename V::Mask;
+    constexpr unsigned max_attempts = 10000;
+    const V zero(0.0);
+    const Mask none = zero < zero;
+    for (std::size_t i = first; i < last; i += V::size) {
+        const std::size_t n = std::min(V::size, last - i);
+        V mVis1 = loadN(events.m_vis1.data() + i, n),
+          pxVis1 = loadN(events.px_vis1.data() + i, n),
+          pyVis1 = loadN(events.py_vis1.data() + i, n),
+          mVis2 = loadN(events.m_vis2.data() + i, n),
+          pxVis2 = loadN(events.px_vis2.data() + i, n),
+          pyVis2 = loadN(events.py_vis2.data() + i, n);
+        const V pxMiss = loadN(events.px_miss.data() + i, n),
+                pyMiss = loadN(events.py_miss.data() + i, n);
+        V mInvis1(hypothesis.m_inv1), mInvis2(hypothesis.m_inv2);
+
+        // Side 1 has the smaller minimum of the parent mass.
+        const auto swap = mVis1 + mInvis1 > mVis2 + mInvis2;
+        auto swapLanes = [swap](V *x1, V *x2) {
+            const V x = *x1;
+            *x1 = select(swap, *x2, x);
+            *x2 = select(swap, x, *x2);
+        };
+        swapLanes(&mVis1, &mVis2);
+        swapLanes(&pxVis1, &pxVis2);
+        swapLanes(&pyVis1, &pyVis2);
+        swapLanes(&mInvis1, &mInvis2);
+        const V mMin = mVis2 + mInvis2;
+
+        const V msSq = mVis1 * mVis1, sx = pxVis1, sy = pyVis1,
+                mpSq = mInvis1 * mInvis1;
+        const V mtSq = mVis2 * mVis2, tx = pxVis2, ty = pyVis2,
+                mqSq = mInvis2 * mInvis2;
+        const V sSq = sx * sx + sy * sy;
+        const V tSq = tx * tx + ty * ty;
+        const V pMissSq = pxMiss * pxMiss + pyMiss * pyMiss;
+        const V massSqSum = msSq + mtSq + mpSq + mqSq;
+        const V scaleSq = (massSqSum + sSq + tSq + pMissSq) / 8.0;
+
+        auto disjoint = [&](V mSq, Mask *singular) {
+            return ellipsesAreDisjoint(
+                ellipse(mSq, msSq, -sx, -sy, mpSq, zero, zero),
+                ellipse(mSq, mtSq, tx, ty, mqSq, pxMiss, pyMiss), singular);
+        };
+
+        // MT2 is 0 if the scale is, e.g., in the lanes beyond `last`. The
+        // reference never ends for NaNs, which are returned here instead.
+        V mt2Sq = select(scaleSq == scaleSq, zero, scaleSq);
+        Mask failed = none;
+        V mLower = mMin;
+        V mUpper = mMin + sqrt(scaleSq);
+        Mask searching = andNot(scaleSq == scaleSq, scaleSq == zero);
+        const Mask active = searching;
+        for (unsigned attempts = 1; any(searching); ++attempts) {
+            Mask singular;
+            const Mask is_disjoint = disjoint(mUpper * mUpper, &singular);
+            failed = failed | (searching & singular);
+            searching = andNot(searching, singular) & is_disjoint;
+            if (attempts >= max_attempts) {
+                failed = failed | searching;
+                searching = none;
+            }
+            mUpper = select(searching, mUpper * 2, mUpper);
+        }
+
+        Mask bisecting = andNot(active, failed);
+        Mask goLow = bisecting;
+        while (any(bisecting)) {
+            if (precision > 0) {
+                const Mask converged =
+                    andNot(bisecting, mUpper - mLower > V(precision));
+                const V mAns = (mLower + mUpper) / 2.0;
+                mt2Sq = select(converged, mAns * mAns, mt2Sq);
+                bisecting = andNot(bisecting, converged);
+            }
+
+            const V trialM = select(goLow, (mLower * 15 + mUpper) / 16,
+                                    (mUpper + mLower) / 2.0);
+            // The interval can no longer be bisected.
+            const Mask limit =
+                bisecting & ((trialM <= mLower) | (trialM >= mUpper));
+            mt2Sq = select(limit, trialM * trialM, mt2Sq);
+            bisecting = andNot(bisecting, limit);
+
+            Mask singular;
+            const Mask is_disjoint = disjoint(trialM * trialM, &singular);
+            mt2Sq = select(bisecting & singular, mLower * mLower, mt2Sq);
+            bisecting = andNot(bisecting, singular);
+            const Mask up = bisecting & is_disjoint;
+            const Mask down = andNot(bisecting, is_disjoint);
+            mLower = select(up, trialM, mLower);
+            goLow = andNot(goLow, up);
+            mUpper = select(down, trialM, mUpper);
+        }
+
+        double result[V::size];
+        select(failed, V(-1.0), sqrt(mt2Sq)).store(result);
+        for (std::size_t l = 0; l < n; ++l) {
+            mt2[(i + l) * stride] = result[l];
+        }
+    }
+}
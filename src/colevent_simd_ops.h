@@ -0,0 +1,275 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_COLEVENT_SIMD_OPS_H_
+#define COLEVENT_SRC_COLEVENT_SIMD_OPS_H_
+
+// Vectors of doubles for the batch kernels. `Double4` uses AVX2 and FMA,
+// and `Double8` AVX-512F. Their functions are compiled for the instruction
+// set with `#pragma GCC target`, so that the rest of the library does not
+// require it, and must only be called from functions compiled in the same
+// way after checking `colevent::simdLevel()`. The kernels written with them
+// are in `colevent_simd_kernels.h`.
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define COLEVENT_X86_SIMD 1
+#endif
+
+#ifdef COLEVENT_X86_SIMD
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+#include "colevent_batch_kinematics.h"
+#include "colevent_mt2.h"
+
+namespace colevent {
+namespace simd {
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+
+struct Mask4 {
+    __m256d m;
+};
+
+inline Mask4 operator&(Mask4 a, Mask4 b) { return {_mm256_and_pd(a.m, b.m)}; }
+inline Mask4 operator|(Mask4 a, Mask4 b) { return {_mm256_or_pd(a.m, b.m)}; }
+inline Mask4 andNot(Mask4 a, Mask4 b) {  // a & ~b
+    return {_mm256_andnot_pd(b.m, a.m)};
+}
+inline bool any(Mask4 a) { return _mm256_movemask_pd(a.m) != 0; }
+inline bool all(Mask4 a) { return _mm256_movemask_pd(a.m) == 0xf; }
+
+struct Double4 {
+    static constexpr std::size_t size = 4;
+    using Mask = Mask4;
+
+    __m256d v;
+
+    Double4() = default;
+    Double4(__m256d x) : v(x) {}
+    Double4(double x) : v(_mm256_set1_pd(x)) {}
+
+    // (0, 1, 2, 3), e.g., to mask the lanes beyond the end of the arrays.
+    static Double4 lanes() { return _mm256_setr_pd(0, 1, 2, 3); }
+    static Double4 load(const double *p) { return _mm256_loadu_pd(p); }
+    void store(double *p) const { _mm256_storeu_pd(p, v); }
+
+    // The first `n` < 4 lanes. The others are zero.
+    static __m256i firstLanes(std::size_t n) {
+        return _mm256_cmpgt_epi64(_mm256_set1_epi64x(std::int64_t(n)),
+                                  _mm256_setr_epi64x(0, 1, 2, 3));
+    }
+    static Double4 loadPartial(const double *p, std::size_t n) {
+        return _mm256_maskload_pd(p, firstLanes(n));
+    }
+    void storePartial(double *p, std::size_t n) const {
+        _mm256_maskstore_pd(p, firstLanes(n), v);
+    }
+};
+
+inline Double4 operator+(Double4 a, Double4 b) {
+    return _mm256_add_pd(a.v, b.v);
+}
+inline Double4 operator-(Double4 a, Double4 b) {
+    return _mm256_sub_pd(a.v, b.v);
+}
+inline Double4 operator*(Double4 a, Double4 b) {
+    return _mm256_mul_pd(a.v, b.v);
+}
+inline Double4 operator/(Double4 a, Double4 b) {
+    return _mm256_div_pd(a.v, b.v);
+}
+inline Double4 operator-(Double4 a) {
+    return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0));
+}
+
+inline Mask4 operator<(Double4 a, Double4 b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)};
+}
+inline Mask4 operator<=(Double4 a, Double4 b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ)};
+}
+inline Mask4 operator>(Double4 a, Double4 b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)};
+}
+inline Mask4 operator>=(Double4 a, Double4 b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ)};
+}
+inline Mask4 operator==(Double4 a, Double4 b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ)};
+}
+
+// `a` where `m` is set, and `b` elsewhere.
+inline Double4 select(Mask4 m, Double4 a, Double4 b) {
+    return _mm256_blendv_pd(b.v, a.v, m.m);
+}
+
+inline Double4 sqrt(Double4 a) { return _mm256_sqrt_pd(a.v); }
+inline Double4 abs(Double4 a) {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v);
+}
+inline Double4 min(Double4 a, Double4 b) { return _mm256_min_pd(a.v, b.v); }
+inline Double4 max(Double4 a, Double4 b) { return _mm256_max_pd(a.v, b.v); }
+// a * b + c with a single rounding.
+inline Double4 fma(Double4 a, Double4 b, Double4 c) {
+    return _mm256_fmadd_pd(a.v, b.v, c.v);
+}
+// The magnitude of `a` with the sign of `b`.
+inline Double4 copySign(Double4 a, Double4 b) {
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    return _mm256_or_pd(_mm256_andnot_pd(sign, a.v), _mm256_and_pd(sign, b.v));
+}
+
+// For a positive normal `x`, the `m` in [sqrt(1/2), sqrt(2)) and the
+// integer `*k` such that x = m 2^k.
+inline Double4 splitExponent(Double4 x, Double4 *k) {
+    constexpr std::int64_t kSqrtHalf = 0x3fe6a09e00000000;
+    const __m256i u = _mm256_add_epi64(
+        _mm256_castpd_si256(x.v),
+        _mm256_set1_epi64x(0x3ff0000000000000 - kSqrtHalf));
+    // The biased exponent is converted exactly through the bits of 2^52.
+    const __m256i e = _mm256_or_si256(_mm256_srli_epi64(u, 52),
+                                      _mm256_set1_epi64x(0x4330000000000000));
+    *k = _mm256_sub_pd(_mm256_castsi256_pd(e), _mm256_set1_pd(0x1p52 + 1023));
+    const __m256i m = _mm256_add_epi64(
+        _mm256_and_si256(u, _mm256_set1_epi64x(0x000fffffffffffff)),
+        _mm256_set1_epi64x(kSqrtHalf));
+    return _mm256_castsi256_pd(m);
+}
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx2,fma")
+
+struct Mask8 {
+    __mmask8 m;
+};
+
+inline Mask8 operator&(Mask8 a, Mask8 b) { return {__mmask8(a.m & b.m)}; }
+inline Mask8 operator|(Mask8 a, Mask8 b) { return {__mmask8(a.m | b.m)}; }
+inline Mask8 andNot(Mask8 a, Mask8 b) { return {__mmask8(a.m & ~b.m)}; }
+inline bool any(Mask8 a) { return a.m != 0; }
+inline bool all(Mask8 a) { return a.m == 0xff; }
+
+struct Double8 {
+    static constexpr std::size_t size = 8;
+    using Mask = Mask8;
+
+    __m512d v;
+
+    Double8() = default;
+    Double8(__m512d x) : v(x) {}
+    Double8(double x) : v(_mm512_set1_pd(x)) {}
+
+    static Double8 lanes() { return _mm512_setr_pd(0, 1, 2, 3, 4, 5, 6, 7); }
+    static Double8 load(const double *p) { return _mm512_loadu_pd(p); }
+    void store(double *p) const { _mm512_storeu_pd(p, v); }
+
+    // The first `n` < 8 lanes. The others are zero.
+    static Double8 loadPartial(const double *p, std::size_t n) {
+        return _mm512_maskz_loadu_pd(__mmask8((1u << n) - 1), p);
+    }
+    void storePartial(double *p, std::size_t n) const {
+        _mm512_mask_storeu_pd(p, __mmask8((1u << n) - 1), v);
+    }
+};
+
+inline Double8 operator+(Double8 a, Double8 b) {
+    return _mm512_add_pd(a.v, b.v);
+}
+inline Double8 operator-(Double8 a, Double8 b) {
+    return _mm512_sub_pd(a.v, b.v);
+}
+inline Double8 operator*(Double8 a, Double8 b) {
+    return _mm512_mul_pd(a.v, b.v);
+}
+inline Double8 operator/(Double8 a, Double8 b) {
+    return _mm512_div_pd(a.v, b.v);
+}
+inline Double8 operator-(Double8 a) {
+    return _mm512_castsi512_pd(
+        _mm512_xor_si512(_mm512_castpd_si512(a.v),
+                         _mm512_set1_epi64(std::int64_t(1) << 63)));
+}
+
+inline Mask8 operator<(Double8 a, Double8 b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ)};
+}
+inline Mask8 operator<=(Double8 a, Double8 b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LE_OQ)};
+}
+inline Mask8 operator>(Double8 a, Double8 b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ)};
+}
+inline Mask8 operator>=(Double8 a, Double8 b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_GE_OQ)};
+}
+inline Mask8 operator==(Double8 a, Double8 b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_EQ_OQ)};
+}
+
+inline Double8 select(Mask8 m, Double8 a, Double8 b) {
+    return _mm512_mask_blend_pd(m.m, b.v, a.v);
+}
+
+inline Double8 sqrt(Double8 a) { return _mm512_sqrt_pd(a.v); }
+inline Double8 abs(Double8 a) {
+    return _mm512_castsi512_pd(
+        _mm512_and_si512(_mm512_castpd_si512(a.v),
+                         _mm512_set1_epi64(0x7fffffffffffffff)));
+}
+inline Double8 min(Double8 a, Double8 b) { return _mm512_min_pd(a.v, b.v); }
+inline Double8 max(Double8 a, Double8 b) { return _mm512_max_pd(a.v, b.v); }
+inline Double8 fma(Double8 a, Double8 b, Double8 c) {
+    return _mm512_fmadd_pd(a.v, b.v, c.v);
+}
+inline Double8 copySign(Double8 a, Double8 b) {
+    const __m512i sign = _mm512_set1_epi64(std::int64_t(1) << 63);
+    return _mm512_castsi512_pd(
+        _mm512_or_si512(_mm512_andnot_si512(sign, _mm512_castpd_si512(a.v)),
+                        _mm512_and_si512(sign, _mm512_castpd_si512(b.v))));
+}
+
+inline Double8 splitExponent(Double8 x, Double8 *k) {
+    constexpr std::int64_t kSqrtHalf = 0x3fe6a09e00000000;
+    const __m512i u = _mm512_add_epi64(
+        _mm512_castpd_si512(x.v),
+        _mm512_set1_epi64(0x3ff0000000000000 - kSqrtHalf));
+    const __m512i e = _mm512_or_si512(_mm512_srli_epi64(u, 52),
+                                      _mm512_set1_epi64(0x4330000000000000));
+    *k = _mm512_sub_pd(_mm512_castsi512_pd(e), _mm512_set1_pd(0x1p52 + 1023));
+    const __m512i m = _mm512_add_epi64(
+        _mm512_and_si512(u, _mm512_set1_epi64(0x000fffffffffffff)),
+        _mm512_set1_epi64(kSqrtHalf));
+    return _mm512_castsi512_pd(m);
+}
+
+#pragma GCC pop_options
+
+// The kernels of `colevent_simd_kernels.h` for each instruction set.
+namespace avx2 {
+void computeKinematics(const KinematicsArrays &arrays);
+void deltaMatrices(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+                   double *dphi, double *dr);
+void minDeltaR(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+               double *min_dr, int *closest);
+void mT2Events(const MT2Columns &events, std::size_t first, std::size_t last,
+               const MT2Hypothesis &hypothesis, double precision, double *mt2,
+               std::size_t stride);
+}  // namespace avx2
+
+namespace avx512 {
+void computeKinematics(const KinematicsArrays &arrays);
+void deltaMatrices(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+                   double *dphi, double *dr);
+void minDeltaR(const EtaPhiColumns &rows, const EtaPhiColumns &cols,
+               double *min_dr, int *closest);
+void mT2Events(const MT2Columns &events, std::size_t first, std::size_t last,
+               const MT2Hypothesis &hypothesis, double precision, double *mt2,
+               std::size_t stride);
+}  // namespace avx512
+}  // namespace simd
+}  // namespace colevent
+#endif  // COLEVENT_X86_SIMD
+
+#endif  // COLEVENT_SRC_COLEVENT_SIMD_OPS_H_
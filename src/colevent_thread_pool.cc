@@ -0,0 +1,39 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "colevent_thread_pool.h"
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace colevent {
+ThreadPool::ThreadPool(unsigned num_threads) {
+    if (num_threads == 0) { num_threads = hardwareThreads(); }
+    workers_.reserve(num_threads);
+    for (unsigned i = 0; i < num_threads; ++i) {
+        workers_.emplace_back([this] { work(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cond_.notify_all();
+    for (auto &w : workers_) { w.join(); }
+}
+
+void ThreadPool::work() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) { return; }  // stopped and nothing left
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+        task();
+    }
+}
+}  // namespace colevent
@@ -0,0 +1,62 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_COLEVENT_THREAD_POOL_H_
+#define COLEVENT_SRC_COLEVENT_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace colevent {
+// Fixed number of worker threads running the submitted tasks in the order
+// of submission. The destructor waits for all the tasks to finish.
+class ThreadPool {
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    bool stop_ = false;
+
+public:
+    // If `num_threads` is 0, the number of hardware threads is used.
+    explicit ThreadPool(unsigned num_threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(workers_.size()); }
+
+    template <typename F>
+    std::future<std::invoke_result_t<F>> submit(F func) {
+        using Result = std::invoke_result_t<F>;
+        auto task =
+            std::make_shared<std::packaged_task<Result()>>(std::move(func));
+        std::future<Result> result = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.emplace([task] { (*task)(); });
+        }
+        cond_.notify_one();
+        return result;
+    }
+
+private:
+    void work();
+};
+
+inline unsigned hardwareThreads() {
+    const unsigned n = std::thread::hardware_concurrency();
+    return n > 0 ? n : 1;
+}
+}  // namespace colevent
+
+#endif  // COLEVENT_SRC_COLEVENT_THREAD_POOL_H_
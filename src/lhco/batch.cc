@@ -0,0 +1,226 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhco/batch.h"
+#include <algorithm>
+#include <cmath>
+#include <istream>
+#include <vector>
+#include "lhco/parser.h"
+
+using colevent::Eta;
+using colevent::Pt;
+
+namespace lhco {
+void ObjectColumns::clear() {
+    pt.clear();
+    eta.clear();
+    phi.clear();
+    mass.clear();
+    hadem.clear();
+    ntrk.clear();
+    btag.clear();
+    offsets.assign(1, 0);
+}
+
+void ObjectColumns::push_back(const Object &obj) {
+    pt.push_back(obj.pt);
+    eta.push_back(obj.eta);
+    phi.push_back(obj.phi);
+    mass.push_back(obj.jmass);
+    hadem.push_back(obj.hadem);
+    ntrk.push_back(obj.ntrk);
+    btag.push_back(obj.btag);
+}
+
+void EventBatch::clear() {
+    for (auto *c : {&photons_, &electrons_, &muons_, &taus_, &jets_, &bjets_}) {
+        c->clear();
+    }
+    met_pt_.clear();
+    met_phi_.clear();
+    event_number_.clear();
+}
+
+// Appends the objects in descending order of pT. `std::sort` is called with
+// the same comparisons as in `Event::sort_particles`, so that the objects
+// with equal pT are in the same order as in `lhco::Event`.
+void appendSorted(Objects *objs, ObjectColumns *columns) {
+    std::sort(objs->begin(), objs->end(),
+              [](const Object &a, const Object &b) { return b.pt < a.pt; });
+    for (const auto &obj : *objs) { columns->push_back(obj); }
+    columns->end_event();
+}
+
+void EventBatch::add_event(const RawEvent &ev) {
+    if (ev.empty()) { return; }
+
+    thread_local std::vector<Objects> by_type(6);
+    for (auto &objs : by_type) { objs.clear(); }
+    double met_pt = 0.0, met_phi = 0.0;
+    for (const auto &obj : ev.objects()) {
+        switch (obj.typ) {
+        case 0:  // photon
+        case 1:  // electron
+        case 2:  // muon
+        case 3:  // tau
+            by_type[obj.typ].push_back(obj);
+            break;
+        case 4:  // b-jet or normal jet
+            by_type[obj.btag > 0.5 ? 5 : 4].push_back(obj);
+            break;
+        default:  // missing energy
+            met_pt = obj.pt;
+            met_phi = obj.phi;
+            break;
+        }
+    }
+
+    appendSorted(&by_type[0], &photons_);
+    appendSorted(&by_type[1], &electrons_);
+    appendSorted(&by_type[2], &muons_);
+    appendSorted(&by_type[3], &taus_);
+    appendSorted(&by_type[4], &jets_);
+    appendSorted(&by_type[5], &bjets_);
+    met_pt_.push_back(met_pt);
+    met_phi_.push_back(met_phi);
+    event_number_.push_back(ev.header().event_number);
+}
+
+std::size_t parseEventBatch(std::istream *is, std::size_t max_events,
+                            EventBatch *batch) {
+    thread_local RawEvent ev;
+    batch->clear();
+    std::size_t num_eve = 0;
+    while (num_eve < max_events && parseRawEvent(is, &ev)) {
+        batch->add_event(ev);
+        ++num_eve;
+    }
+    return num_eve;
+}
+
+std::size_t parseEventBatch(const char **pos, const char *last,
+                            std::size_t max_events, EventBatch *batch) {
+    thread_local RawEvent ev;
+    batch->clear();
+    std::size_t num_eve = 0;
+    while (num_eve < max_events) {
+        *pos = parseRawEvent(*pos, last, &ev);
+        if (ev.empty()) { break; }
+        batch->add_event(ev);
+        ++num_eve;
+    }
+    return num_eve;
+}
+
+std::vector<int> numOfParticles(const ObjectColumns &ps) {
+    const std::size_t num_eve = ps.offsets.size() - 1;
+    std::vector<int> count(num_eve);
+    for (std::size_t i = 0; i < num_eve; ++i) {
+        count[i] = static_cast<int>(ps.offsets[i + 1] - ps.offsets[i]);
+    }
+    return count;
+}
+
+std::vector<int> numOfParticles(const Pt &pt, const Eta &eta,
+                                const ObjectColumns &ps) {
+    // The cut is evaluated over the contiguous columns, which the compiler
+    // vectorizes, into a running count of the passing objects. The count of
+    // an event is then the difference at its offsets.
+    thread_local std::vector<int> pass;
+    const std::size_t n = ps.size();
+    pass.resize(n + 1);
+    const double *ps_pt = ps.pt.data();
+    const double *ps_eta = ps.eta.data();
+    int *pass_ptr = pass.data();
+    for (std::size_t k = 0; k < n; ++k) {
+        pass_ptr[k + 1] =
+            (ps_pt[k] > pt.value) & (std::abs(ps_eta[k]) < eta.value);
+    }
+    pass_ptr[0] = 0;
+    for (std::size_t k = 0; k < n; ++k) { pass_ptr[k + 1] += pass_ptr[k]; }
+
+    const std::size_t num_eve = ps.offsets.size() - 1;
+    const std::size_t *offsets = ps.offsets.data();
+    std::vector<int> count(num_eve);
+    for (std::size_t i = 0; i < num_eve; ++i) {
+        count[i] = pass_ptr[offsets[i + 1]] - pass_ptr[offsets[i]];
+    }
+    return count;
+}
+
+std::vector<int> addColumns(std::vector<int> lhs,
+                            const std::vector<int> &rhs) {
+    for (std::size_t i = 0; i < lhs.size(); ++i) { lhs[i] += rhs[i]; }
+    return lhs;
+}
+
+std::vector<int> numPhoton(const EventBatch &batch) {
+    return numOfParticles(batch.photons());
+}
+
+std::vector<int> numPhoton(const Pt &pt, const Eta &eta,
+                           const EventBatch &batch) {
+    return numOfParticles(pt, eta, batch.photons());
+}
+
+std::vector<int> numElectron(const EventBatch &batch) {
+    return numOfParticles(batch.electrons());
+}
+
+std::vector<int> numElectron(const Pt &pt, const Eta &eta,
+                             const EventBatch &batch) {
+    return numOfParticles(pt, eta, batch.electrons());
+}
+
+std::vector<int> numMuon(const EventBatch &batch) {
+    return numOfParticles(batch.muons());
+}
+
+std::vector<int> numMuon(const Pt &pt, const Eta &eta,
+                         const EventBatch &batch) {
+    return numOfParticles(pt, eta, batch.muons());
+}
+
+std::vector<int> numLeptonIso(const EventBatch &batch) {
+    return addColumns(numElectron(batch), numMuon(batch));
+}
+
+std::vector<int> numTau(const EventBatch &batch) {
+    return numOfParticles(batch.taus());
+}
+
+std::vector<int> numTau(const Pt &pt, const Eta &eta, const EventBatch &batch) {
+    return numOfParticles(pt, eta, batch.taus());
+}
+
+std::vector<int> numNormalJet(const EventBatch &batch) {
+    return numOfParticles(batch.jets());
+}
+
+std::vector<int> numNormalJet(const Pt &pt, const Eta &eta,
+                              const EventBatch &batch) {
+    return numOfParticles(pt, eta, batch.jets());
+}
+
+std::vector<int> numBjet(const EventBatch &batch) {
+    return numOfParticles(batch.bjets());
+}
+
+std::vector<int> numBjet(const Pt &pt, const Eta &eta,
+                         const EventBatch &batch) {
+    return numOfParticles(pt, eta, batch.bjets());
+}
+
+std::vector<int> numAllJet(const EventBatch &batch) {
+    return addColumns(numNormalJet(batch), numBjet(batch));
+}
+
+std::vector<int> numAllJet(const Pt &pt, const Eta &eta,
+                           const EventBatch &batch) {
+    return addColumns(numNormalJet(pt, eta, batch), numBjet(pt, eta, batch));
+}
+
+std::vector<double> missingET(const EventBatch &batch) {
+    return batch.met_pt();
+}
+}  // namespace lhco
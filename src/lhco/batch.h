@@ -0,0 +1,128 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_LHCO_BATCH_H_
+#define COLEVENT_SRC_LHCO_BATCH_H_
+
+#include <cstddef>
+#include <istream>
+#include <vector>
+#include "colevent_kinematics.h"
+#include "lhco/event.h"
+#include "lhco/object.h"
+
+namespace lhco {
+// The objects of one type in a batch of events, column by column. The
+// objects of the event i are at the indices [offsets[i], offsets[i + 1]),
+// sorted in descending order of pT as in `lhco::Event`.
+struct ObjectColumns {
+    std::vector<double> pt;
+    std::vector<double> eta;
+    std::vector<double> phi;
+    std::vector<double> mass;
+    std::vector<double> hadem;
+    std::vector<int> ntrk;
+    std::vector<int> btag;
+    std::vector<std::size_t> offsets = {0};
+
+    // The number of objects in all the events.
+    std::size_t size() const { return pt.size(); }
+    std::size_t size(std::size_t ievent) const {
+        return offsets[ievent + 1] - offsets[ievent];
+    }
+
+    void clear();
+    void push_back(const Object &obj);
+    // Closes the list of objects of the current event.
+    void end_event() { offsets.push_back(pt.size()); }
+};
+
+// A batch of LHCO events in the structure-of-arrays form. It is filled by
+// `parseEventBatch` without building `lhco::Event` objects, and the batch
+// variants of the counting functions in `lhco/lhco.h` loop over its columns.
+class EventBatch {
+private:
+    ObjectColumns photons_;
+    ObjectColumns electrons_;
+    ObjectColumns muons_;
+    ObjectColumns taus_;
+    ObjectColumns jets_;
+    ObjectColumns bjets_;
+    std::vector<double> met_pt_;
+    std::vector<double> met_phi_;
+    std::vector<int> event_number_;
+
+public:
+    EventBatch() {}
+
+    // The number of events.
+    std::size_t size() const { return met_pt_.size(); }
+    bool empty() const { return met_pt_.empty(); }
+    // Removes the events, keeping the allocated storage.
+    void clear();
+
+    // Sorts the objects of a raw event into the columns.
+    void add_event(const RawEvent &ev);
+
+    const ObjectColumns &photons() const { return photons_; }
+    const ObjectColumns &electrons() const { return electrons_; }
+    const ObjectColumns &muons() const { return muons_; }
+    const ObjectColumns &taus() const { return taus_; }
+    const ObjectColumns &jets() const { return jets_; }
+    const ObjectColumns &bjets() const { return bjets_; }
+    const std::vector<double> &met_pt() const { return met_pt_; }
+    const std::vector<double> &met_phi() const { return met_phi_; }
+    const std::vector<int> &event_number() const { return event_number_; }
+};
+
+// Reads up to `max_events` events into the batch, replacing its contents.
+// It returns the number of events read, which is zero at the end of input.
+std::size_t parseEventBatch(std::istream *is, std::size_t max_events,
+                            EventBatch *batch);
+
+// Parses the events in [*pos, last) and moves `*pos` past them.
+std::size_t parseEventBatch(const char **pos, const char *last,
+                            std::size_t max_events, EventBatch *batch);
+
+// The batch variants of the counting functions. The element i of the result
+// is for the event i of the batch.
+std::vector<int> numPhoton(const EventBatch &batch);
+
+std::vector<int> numPhoton(const colevent::Pt &pt, const colevent::Eta &eta,
+                           const EventBatch &batch);
+
+std::vector<int> numElectron(const EventBatch &batch);
+
+std::vector<int> numElectron(const colevent::Pt &pt, const colevent::Eta &eta,
+                             const EventBatch &batch);
+
+std::vector<int> numMuon(const EventBatch &batch);
+
+std::vector<int> numMuon(const colevent::Pt &pt, const colevent::Eta &eta,
+                         const EventBatch &batch);
+
+std::vector<int> numLeptonIso(const EventBatch &batch);
+
+std::vector<int> numTau(const EventBatch &batch);
+
+std::vector<int> numTau(const colevent::Pt &pt, const colevent::Eta &eta,
+                        const EventBatch &batch);
+
+std::vector<int> numNormalJet(const EventBatch &batch);
+
+std::vector<int> numNormalJet(const colevent::Pt &pt, const colevent::Eta &eta,
+                              const EventBatch &batch);
+
+std::vector<int> numBjet(const EventBatch &batch);
+
+std::vector<int> numBjet(const colevent::Pt &pt, const colevent::Eta &eta,
+                         const EventBatch &batch);
+
+std::vector<int> numAllJet(const EventBatch &batch);
+
+std::vector<int> numAllJet(const colevent::Pt &pt, const colevent::Eta &eta,
+                           const EventBatch &batch);
+
+std::vector<double> missingET(const EventBatch &batch);
+}  // namespace lhco
+
+#endif  // COLEVENT_SRC_LHCO_BATCH_H_
@@ -0,0 +1,184 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhco/cache.h"
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "colevent_mapped_file.h"
+#include "lhco/parser.h"
+#include "lhco/writer.h"
+
+using colevent::bytesOf;
+
+namespace lhco {
+namespace {
+enum Column : std::size_t {
+    kEventNumber,
+    kTriggerWord,
+    kNumObjects,
+    kTyp,
+    kEta,
+    kPhi,
+    kPt,
+    kJmass,
+    kNtrk,
+    kBtag,
+    kHadem,
+    kNumColumns
+};
+
+// Whether the columns of a row group have the sizes of the schema.
+bool isValid(const colevent::RowGroup &group) {
+    const auto n = group.num_events, m = group.num_rows;
+    if (!(group.hasColumn<std::int32_t>(kEventNumber, n) &&
+          group.hasColumn<std::int32_t>(kTriggerWord, n) &&
+          group.hasColumn<std::uint32_t>(kNumObjects, n) &&
+          group.hasColumn<std::int32_t>(kTyp, m) &&
+          group.hasColumn<double>(kEta, m) &&
+          group.hasColumn<double>(kPhi, m) &&
+          group.hasColumn<double>(kPt, m) &&
+          group.hasColumn<double>(kJmass, m) &&
+          group.hasColumn<std::int32_t>(kNtrk, m) &&
+          group.hasColumn<std::int32_t>(kBtag, m) &&
+          group.hasColumn<double>(kHadem, m))) {
+        return false;
+    }
+    const auto num_objects = group.column<std::uint32_t>(kNumObjects);
+    std::uint64_t num_rows = 0;
+    for (std::uint64_t i = 0; i < n; ++i) { num_rows += num_objects[i]; }
+    return num_rows == m;
+}
+}  // namespace
+
+CacheWriter::CacheWriter(const std::string &fname, std::string_view metadata,
+                         std::size_t group_size)
+    : out_(fname, colevent::EventFormat::LHCO, kNumColumns, metadata),
+      group_size_(group_size > 0 ? group_size : 1) {}
+
+bool CacheWriter::add(const RawEvent &ev) {
+    if (!is_open()) { return false; }
+    event_number_.push_back(ev.header().event_number);
+    trigger_word_.push_back(ev.header().trigger_word);
+    num_objects_.push_back(static_cast<std::uint32_t>(ev.objects().size()));
+    for (const auto &obj : ev.objects()) {
+        typ_.push_back(obj.typ);
+        eta_.push_back(obj.eta);
+        phi_.push_back(obj.phi);
+        pt_.push_back(obj.pt);
+        jmass_.push_back(obj.jmass);
+        ntrk_.push_back(obj.ntrk);
+        btag_.push_back(obj.btag);
+        hadem_.push_back(obj.hadem);
+    }
+    return event_number_.size() < group_size_ || writeRowGroup();
+}
+
+bool CacheWriter::writeRowGroup() {
+    const bool ok = out_.writeRowGroup(
+        event_number_.size(), typ_.size(),
+        {bytesOf(event_number_), bytesOf(trigger_word_), bytesOf(num_objects_),
+         bytesOf(typ_), bytesOf(eta_), bytesOf(phi_), bytesOf(pt_),
+         bytesOf(jmass_), bytesOf(ntrk_), bytesOf(btag_), bytesOf(hadem_)});
+    for (auto *column : {&event_number_, &trigger_word_, &typ_, &ntrk_,
+                         &btag_}) {
+        column->clear();
+    }
+    for (auto *column : {&eta_, &phi_, &pt_, &jmass_, &hadem_}) {
+        column->clear();
+    }
+    num_objects_.clear();
+    return ok;
+}
+
+bool CacheWriter::close() {
+    if (!is_open()) { return false; }
+    const bool ok = event_number_.empty() || writeRowGroup();
+    return out_.close() && ok;
+}
+
+CacheReader::CacheReader(const std::string &fname) : file_(fname) {
+    valid_ = file_.is_open() &&
+             file_.format() == colevent::EventFormat::LHCO &&
+             file_.numColumns() == kNumColumns;
+    for (const auto &group : file_.rowGroups()) {
+        valid_ = valid_ && isValid(group);
+    }
+}
+
+bool CacheReader::next(RawEvent *ev) {
+    ev->reset();
+    if (!valid_) { return false; }
+    const auto &groups = file_.rowGroups();
+    while (group_ < groups.size() && event_ == groups[group_].num_events) {
+        ++group_;
+        event_ = row_ = 0;
+    }
+    if (group_ == groups.size()) { return false; }
+
+    const auto &group = groups[group_];
+    ev->set_header(Header(group.column<std::int32_t>(kEventNumber)[event_],
+                          group.column<std::int32_t>(kTriggerWord)[event_]));
+    const auto num_objects = group.column<std::uint32_t>(kNumObjects)[event_];
+    for (std::size_t k = row_; k < row_ + num_objects; ++k) {
+        ev->add_object(Object(group.column<std::int32_t>(kTyp)[k],
+                              group.column<double>(kEta)[k],
+                              group.column<double>(kPhi)[k],
+                              group.column<double>(kPt)[k],
+                              group.column<double>(kJmass)[k],
+                              group.column<std::int32_t>(kNtrk)[k],
+                              group.column<std::int32_t>(kBtag)[k],
+                              group.column<double>(kHadem)[k]));
+    }
+    (*ev)(EventStatus::Fill);
+    ++event_;
+    row_ += num_objects;
+    return true;
+}
+
+bool CacheReader::next(Event *ev, const SortOrder &order) {
+    thread_local RawEvent raw_ev;
+    const bool ok = next(&raw_ev);
+    *ev = toEvent(raw_ev, order);
+    return ok;
+}
+
+std::size_t CacheReader::next_batch(std::size_t max_events,
+                                    EventBatch *batch) {
+    thread_local RawEvent raw_ev;
+    batch->clear();
+    std::size_t num_eve = 0;
+    while (num_eve < max_events && next(&raw_ev)) {
+        batch->add_event(raw_ev);
+        ++num_eve;
+    }
+    return num_eve;
+}
+
+bool convertToCache(const std::string &fname, const std::string &cache_fname,
+                    std::size_t group_size) {
+    const colevent::MappedFile file(fname);
+    if (!file.is_open()) { return false; }
+    const char *first = findHeaderLine(file.begin(), file.end());
+    CacheWriter writer(cache_fname,
+                       std::string_view(file.begin(), first - file.begin()),
+                       group_size);
+    if (!writer.is_open()) { return false; }
+    RawEvent ev;
+    for (const char *pos = first;
+         (pos = parseRawEvent(pos, file.end(), &ev)), !ev.empty();) {
+        if (!writer.add(ev)) { return false; }
+    }
+    return writer.close();
+}
+
+bool convertToText(const std::string &cache_fname, std::ostream *os) {
+    CacheReader reader(cache_fname);
+    if (!reader.is_open()) { return false; }
+    Writer writer(os);
+    writer << reader.metadata();
+    for (RawEvent ev; reader.next(&ev);) { writer << ev << '\n'; }
+    writer.flush();
+    return static_cast<bool>(*os);
+}
+}  // namespace lhco
@@ -0,0 +1,85 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_LHCO_CACHE_H_
+#define COLEVENT_SRC_LHCO_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "colevent_columnar.h"
+#include "lhco/batch.h"
+#include "lhco/event.h"
+
+namespace lhco {
+// Writes raw events to a columnar cache file (see `colevent_columnar.h`) in
+// row groups of `group_size` events. The columns are the event number, the
+// trigger word and the number of objects of each event, and the fields of
+// the objects: typ, eta, phi, pt, jmass, ntrk, btag and hadem. `metadata`
+// is kept as it is, e.g., the text before the first event of the input.
+class CacheWriter {
+private:
+    colevent::ColumnarWriter out_;
+    std::size_t group_size_;
+    std::vector<std::int32_t> event_number_, trigger_word_;
+    std::vector<std::uint32_t> num_objects_;
+    std::vector<std::int32_t> typ_, ntrk_, btag_;
+    std::vector<double> eta_, phi_, pt_, jmass_, hadem_;
+
+public:
+    explicit CacheWriter(const std::string &fname,
+                         std::string_view metadata = {},
+                         std::size_t group_size = 1 << 16);
+    ~CacheWriter() { close(); }
+
+    bool is_open() const { return out_.is_open(); }
+
+    bool add(const RawEvent &ev);
+
+    // Writes the remaining events and the footer.
+    bool close();
+
+private:
+    bool writeRowGroup();
+};
+
+// Reads the events of a cache file written by `CacheWriter` in place from
+// the memory-mapped file.
+class CacheReader {
+private:
+    colevent::ColumnarFile file_;
+    bool valid_ = false;
+    std::size_t group_ = 0;
+    std::size_t event_ = 0;  // in the current row group
+    std::size_t row_ = 0;    // in the current row group
+
+public:
+    explicit CacheReader(const std::string &fname);
+
+    // False if the file cannot be opened or is not an LHCO cache.
+    bool is_open() const { return valid_; }
+    std::uint64_t size() const { return file_.numEvents(); }
+    std::string_view metadata() const { return file_.metadata(); }
+
+    // Reads the next event. They return false at the end of the file.
+    bool next(RawEvent *ev);
+    bool next(Event *ev, const SortOrder &order = SortOrder());
+
+    // Reads up to `max_events` events into the batch, replacing its
+    // contents. It returns the number of events read.
+    std::size_t next_batch(std::size_t max_events, EventBatch *batch);
+};
+
+// Converts a text file, which is not compressed, to a cache file. It
+// returns false if either file cannot be opened.
+bool convertToCache(const std::string &fname, const std::string &cache_fname,
+                    std::size_t group_size = 1 << 16);
+
+// Writes the text of a cache file, i.e., its metadata followed by the events
+// rendered as by `operator<<`.
+bool convertToText(const std::string &cache_fname, std::ostream *os);
+}  // namespace lhco
+
+#endif  // COLEVENT_SRC_LHCO_CACHE_H_
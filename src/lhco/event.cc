@@ -34,7 +34,7 @@ std::string showAll(const std::vector<T> &ps) {
     std::string str = "";
     if (!ps.empty()) {
         str += "[";
-        for (const auto &p : ps) { str += p.show() + ","; }
+        for (const auto &p : ps) { str += lhco::show(p) + ","; }
         str.pop_back();
         str += "],";
     }
@@ -45,21 +45,34 @@ std::string Event::show() const {
     std::string str = "Event {";
     str += showAll(photons_) + showAll(electrons_) + showAll(muons_);
     str += showAll(taus_) + showAll(jets_) + showAll(bjets_);
-    str += met_.show() + "}";
+    str += lhco::show(met_) + "}";
     return str;
 }
 
 template <typename T>
-void sortByPt(std::vector<T> *ps) {
-    if (!ps->empty()) { std::sort(ps->begin(), ps->end(), std::greater<T>()); }
+void sortByPt(const SortOrder &order, std::vector<T> *ps) {
+    if (ps->size() < 2) { return; }
+    switch (order.policy) {
+    case SortPolicy::Full:
+        std::sort(ps->begin(), ps->end(), std::greater<T>());
+        break;
+    case SortPolicy::TopK: {
+        const auto k = std::min(order.k, ps->size());
+        std::partial_sort(ps->begin(), ps->begin() + k, ps->end(),
+                          std::greater<T>());
+        break;
+    }
+    default:
+        break;
+    }
 }
 
-void Event::sort_particles() {
-    sortByPt(&photons_);
-    sortByPt(&electrons_);
-    sortByPt(&muons_);
-    sortByPt(&taus_);
-    sortByPt(&jets_);
-    sortByPt(&bjets_);
+void Event::sort_particles(const SortOrder &order) {
+    sortByPt(order, &photons_);
+    sortByPt(order, &electrons_);
+    sortByPt(order, &muons_);
+    sortByPt(order, &taus_);
+    sortByPt(order, &jets_);
+    sortByPt(order, &bjets_);
 }
 }  // namespace lhco
@@ -3,8 +3,12 @@
 #ifndef COLEVENT_SRC_LHCO_EVENT_H_
 #define COLEVENT_SRC_LHCO_EVENT_H_
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 #include "lhco/object.h"
 #include "lhco/particle.h"
@@ -12,6 +16,22 @@
 namespace lhco {
 enum class EventStatus { Empty, Fill };
 
+// How `Event::sort_particles` orders the objects of each type by pT.
+//   - Full: all the objects in descending order of pT (the default).
+//   - TopK: only the leading `k` objects in descending order of pT, followed
+//     by the others in unspecified order.
+//   - None: the objects in the order of the input. See `leading` below.
+enum class SortPolicy { Full, TopK, None };
+
+struct SortOrder {
+    SortPolicy policy = SortPolicy::Full;
+    std::size_t k = 2;
+
+    SortOrder() {}
+    explicit SortOrder(SortPolicy _policy, std::size_t _k = 2)
+        : policy(_policy), k(_k) {}
+};
+
 class RawEvent {
 private:
     EventStatus status_;
@@ -28,8 +48,21 @@ public:
         header_ = header;
         objects_ = objects;
     }
-    Header header() const { return header_; }
-    Objects objects() const { return objects_; }
+    // Starts a new event, keeping the storage of the objects. It is used by
+    // the parser together with `set_header` and `add_object`.
+    void reset() {
+        status_ = EventStatus::Empty;
+        header_ = Header();
+        objects_.clear();
+    }
+    void set_header(const Header &header) { header_ = header; }
+    void add_object(const Object &obj) { objects_.push_back(obj); }
+
+    // See the accessors of `Event` below.
+    const Header &header() const & { return header_; }
+    Header header() && { return header_; }
+    const Objects &objects() const & { return objects_; }
+    Objects objects() && { return std::move(objects_); }
     bool empty() const { return status_ == EventStatus::Empty; }
     void operator()(const EventStatus &s) { status_ = s; }
 
@@ -42,6 +75,7 @@ inline std::string show(const RawEvent &ev) { return ev.show(); }
 class Event {
 private:
     EventStatus status_;
+    Header header_;
 
     std::vector<Photon> photons_;
     std::vector<Electron> electrons_;
@@ -54,7 +88,15 @@ private:
 public:
     explicit Event(EventStatus s = EventStatus::Empty) : status_(s) {}
 
-    std::vector<Photon> photons() const { return photons_; }
+    const Header &header() const & { return header_; }
+    Header header() && { return header_; }
+    void set_header(const Header &header) { header_ = header; }
+
+    // The collections are returned by reference, without copying. For a
+    // temporary event, e.g., `lhco::parseEvent(&fin).jets()`, they are moved
+    // out so that they do not dangle.
+    const std::vector<Photon> &photons() const & { return photons_; }
+    std::vector<Photon> photons() && { return std::move(photons_); }
     void add_photon(const Object &obj) {
         status_ = EventStatus::Fill;
         Photon photon{colevent::Pt{obj.pt}, colevent::Eta{obj.eta},
@@ -62,7 +104,8 @@ public:
         photons_.push_back(photon);
     }
 
-    std::vector<Electron> electrons() const { return electrons_; }
+    const std::vector<Electron> &electrons() const & { return electrons_; }
+    std::vector<Electron> electrons() && { return std::move(electrons_); }
     void add_electron(const Object &obj) {
         status_ = EventStatus::Fill;
         Electron elec{colevent::Pt{obj.pt}, colevent::Eta{obj.eta},
@@ -71,7 +114,8 @@ public:
         electrons_.push_back(elec);
     }
 
-    std::vector<Muon> muons() const { return muons_; }
+    const std::vector<Muon> &muons() const & { return muons_; }
+    std::vector<Muon> muons() && { return std::move(muons_); }
     void add_muon(const Object &obj) {
         status_ = EventStatus::Fill;
         Muon muon{colevent::Pt{obj.pt},
@@ -83,7 +127,8 @@ public:
         muons_.push_back(muon);
     }
 
-    std::vector<Tau> taus() const { return taus_; }
+    const std::vector<Tau> &taus() const & { return taus_; }
+    std::vector<Tau> taus() && { return std::move(taus_); }
     void add_tau(const Object &obj) {
         status_ = EventStatus::Fill;
         Tau tau{colevent::Pt{obj.pt}, colevent::Eta{obj.eta},
@@ -91,7 +136,8 @@ public:
         taus_.push_back(tau);
     }
 
-    std::vector<Jet> jets() const { return jets_; }
+    const std::vector<Jet> &jets() const & { return jets_; }
+    std::vector<Jet> jets() && { return std::move(jets_); }
     void add_jet(const Object &obj) {
         status_ = EventStatus::Fill;
         Jet jet{colevent::Pt{obj.pt}, colevent::Eta{obj.eta},
@@ -99,7 +145,8 @@ public:
         jets_.push_back(jet);
     }
 
-    std::vector<Bjet> bjets() const { return bjets_; }
+    const std::vector<Bjet> &bjets() const & { return bjets_; }
+    std::vector<Bjet> bjets() && { return std::move(bjets_); }
     void add_bjet(const Object &obj) {
         status_ = EventStatus::Fill;
         Bjet bjet{colevent::Pt{obj.pt},
@@ -111,7 +158,8 @@ public:
         bjets_.push_back(bjet);
     }
 
-    Met met() const { return met_; }
+    const Met &met() const & { return met_; }
+    Met met() && { return met_; }
     void set_met(const Object &obj) {
         status_ = EventStatus::Fill;
         met_ = Met{colevent::Pt{obj.pt}, colevent::Phi{obj.phi}};
@@ -120,7 +168,7 @@ public:
     bool empty() const { return status_ == EventStatus::Empty; }
     bool done() const { return empty(); }
 
-    void sort_particles();
+    void sort_particles(const SortOrder &order = SortOrder());
 
     std::string show() const;
 
@@ -128,6 +176,17 @@ public:
 };
 
 inline std::string show(const Event &ev) { return ev.show(); }
+
+// The leading `n` objects in descending order of pT, whatever the order of
+// `ps` is. It sorts only a copy of the leading objects, so that it is cheap
+// for the collections of an event read with `SortPolicy::None`.
+template <typename T>
+std::vector<T> leading(const std::vector<T> &ps, std::size_t n) {
+    std::vector<T> lead(std::min(n, ps.size()));
+    std::partial_sort_copy(ps.cbegin(), ps.cend(), lead.begin(), lead.end(),
+                           std::greater<T>());
+    return lead;
+}
 }  // namespace lhco
 
 #endif  // COLEVENT_SRC_LHCO_EVENT_H_
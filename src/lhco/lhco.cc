@@ -71,8 +71,13 @@ int numAllJet(const Pt &pt, const Eta &eta, const Event &ev) {
 double missingET(const Event &ev) { return ev.met().pt(); }
 
 double invariantMass(const Visibles &ps) {
-    Visible vis{Energy(0.0), Px(0.0), Py(0.0), Pz(0.0)};
-    for (const auto &p : ps) { vis += p; }
-    return vis.mass();
+    double e = 0.0, px = 0.0, py = 0.0, pz = 0.0;
+    for (const auto &p : ps) {
+        e += p.energy();
+        px += p.px();
+        py += p.py();
+        pz += p.pz();
+    }
+    return colevent::FourMomentum(Energy(e), Px(px), Py(py), Pz(pz)).mass();
 }
 }  // namespace lhco
@@ -4,13 +4,14 @@
 #define COLEVENT_SRC_LHCO_LHCO_H_
 
 #include <string>
+#include "lhco/batch.h"
 #include "lhco/event.h"
 #include "lhco/object.h"
 #include "lhco/parser.h"
 #include "lhco/particle.h"
 
 namespace lhco {
-std::string openingLine() {
+inline std::string openingLine() {
     std::string line = "  #  ";
     line += "typ      eta    phi      pt    jmas  ntrk  btag   had/em";
     line += "  dum1  dum2";
@@ -0,0 +1,28 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhco/mapped_reader.h"
+
+namespace lhco {
+bool MappedReader::selectEvents(const colevent::EventIndex &index,
+                                std::size_t i, std::size_t j) {
+    if (index.sourceSize() != file_.size() || i > j || j > index.size()) {
+        return false;
+    }
+    pos_ = i < index.size() ? file_.begin() + index.offset(i) : file_.end();
+    last_ = j < index.size() ? file_.begin() + index.offset(j) : file_.end();
+    return true;
+}
+
+bool MappedReader::next(RawEvent *ev) {
+    pos_ = parseRawEvent(pos_, last_, ev);
+    if (prescale_ > 1) { skip(prescale_ - 1); }
+    return !ev->empty();
+}
+
+bool MappedReader::next(Event *ev, const SortOrder &order) {
+    thread_local RawEvent raw_ev;
+    const bool ok = next(&raw_ev);
+    *ev = toEvent(raw_ev, order);
+    return ok;
+}
+}  // namespace lhco
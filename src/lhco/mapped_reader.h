@@ -0,0 +1,55 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_LHCO_MAPPED_READER_H_
+#define COLEVENT_SRC_LHCO_MAPPED_READER_H_
+
+#include <cstddef>
+#include <string>
+#include "colevent_event_index.h"
+#include "colevent_mapped_file.h"
+#include "lhco/event.h"
+#include "lhco/parser.h"
+
+namespace lhco {
+// Reads events from a memory-mapped LHCO file, which can be skipped or
+// prescaled without being parsed.
+class MappedReader {
+private:
+    colevent::MappedFile file_;
+    const char *pos_ = nullptr;
+    const char *last_ = nullptr;
+    std::size_t prescale_ = 1;
+
+public:
+    explicit MappedReader(const std::string &fname)
+        : file_(fname), pos_(file_.begin()), last_(file_.end()) {}
+
+    explicit operator bool() const { return file_.is_open(); }
+
+    // Restricts the reader to the events [i, j) of the index, which must have
+    // been built from the same file. `seek(index, i)` reads from the `i`-th
+    // event to the end. They return false if the index does not fit the file.
+    bool selectEvents(const colevent::EventIndex &index, std::size_t i,
+                      std::size_t j);
+    bool seek(const colevent::EventIndex &index, std::size_t i) {
+        return selectEvents(index, i, index.size());
+    }
+
+    // Skips the next `n` events without parsing them. It returns the number
+    // of events skipped.
+    std::size_t skip(std::size_t n) {
+        return lhco::skipEvents(&pos_, last_, n);
+    }
+
+    // Reads only every `k`-th event from now on: the `k - 1` events after
+    // each event read are skipped. `prescale(1)` reads all the events.
+    void prescale(std::size_t k) { prescale_ = k == 0 ? 1 : k; }
+
+    // Reads the next event. They return false at the end of the file or at
+    // a line that is not a valid LHCO line.
+    bool next(RawEvent *ev);
+    bool next(Event *ev, const SortOrder &order = SortOrder());
+};
+}  // namespace lhco
+
+#endif  // COLEVENT_SRC_LHCO_MAPPED_READER_H_
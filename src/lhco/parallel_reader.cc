@@ -0,0 +1,152 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhco/parallel_reader.h"
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include "colevent_charconv.h"
+#include "colevent_mapped_file.h"
+#include "colevent_thread_pool.h"
+#include "lhco/parser.h"
+
+namespace lhco {
+using Chunk = std::pair<const char *, const char *>;
+
+std::vector<Chunk> splitIntoChunks(const char *first, const char *last,
+                                   std::size_t chunk_size) {
+    std::vector<Chunk> chunks;
+    if (chunk_size == 0) { chunk_size = 1; }
+    const char *begin = first;
+    while (begin != last) {
+        const char *end = last;
+        if (static_cast<std::size_t>(last - begin) > chunk_size) {
+            const char *line = colevent::nextLine(begin + chunk_size - 1, last);
+            end = findHeaderLine(line, last);
+        }
+        chunks.push_back({begin, end});
+        begin = end;
+    }
+    return chunks;
+}
+
+struct ChunkResult {
+    std::vector<Event> events;
+    long num_eve = 0;
+    std::vector<UndefinedLine> undefined_lines;
+};
+
+// Parses the events of a chunk and passes them to `deliver`. An event with
+// an undefined line is skipped up to the next event header line.
+template <typename Deliver>
+ChunkResult parseChunk(const char *first, const Chunk &chunk,
+                       std::size_t ichunk, const SortOrder &order,
+                       Deliver deliver) {
+    ChunkResult result;
+    thread_local RawEvent raw_ev;
+    const char *pos = chunk.first;
+    while (pos != chunk.second) {
+        const char *undefined_line;
+        pos = parseRawEvent(pos, chunk.second, &raw_ev, &undefined_line);
+        if (undefined_line != nullptr) {
+            const char *end = colevent::nextLine(undefined_line, chunk.second);
+            if (*(end - 1) == '\n') { --end; }
+            UndefinedLine line;
+            line.chunk = ichunk;
+            line.offset = undefined_line - first;
+            line.text.assign(undefined_line, end);
+            result.undefined_lines.push_back(std::move(line));
+            pos = findHeaderLine(pos, chunk.second);
+        } else if (!raw_ev.empty()) {
+            deliver(toEvent(raw_ev, order), &result);
+            ++result.num_eve;
+        }
+    }
+    return result;
+}
+
+long parseEventsParallel(const char *first, const char *last,
+                         const std::function<void(const Event &)> &func,
+                         const ParallelOptions &opts,
+                         std::vector<UndefinedLine> *undefined_lines) {
+    const auto chunks = splitIntoChunks(first, last, opts.chunk_size);
+    colevent::ThreadPool pool(opts.num_threads);
+    long num_eve = 0;
+    std::vector<UndefinedLine> undefined;
+    auto collect = [&num_eve, &undefined](ChunkResult *result) {
+        num_eve += result->num_eve;
+        std::move(result->undefined_lines.begin(),
+                  result->undefined_lines.end(),
+                  std::back_inserter(undefined));
+    };
+
+    if (!opts.ordered) {
+        std::vector<std::future<ChunkResult>> results;
+        results.reserve(chunks.size());
+        for (std::size_t i = 0; i < chunks.size(); ++i) {
+            results.push_back(pool.submit([first, &chunks, i, &opts, &func] {
+                return parseChunk(first, chunks[i], i, opts.sort_order,
+                                  [&func](const Event &ev, ChunkResult *) {
+                                      func(ev);
+                                  });
+            }));
+        }
+        for (auto &r : results) {
+            auto result = r.get();
+            collect(&result);
+        }
+    } else {
+        // Keep a few chunks per thread in flight. The parsed chunks are
+        // delivered in the order of submission, which bounds the memory in
+        // use.
+        const std::size_t max_in_flight = 2 * pool.size();
+        std::deque<std::future<ChunkResult>> results;
+        std::size_t next_chunk = 0;
+        while (next_chunk != chunks.size() || !results.empty()) {
+            while (next_chunk != chunks.size() &&
+                   results.size() < max_in_flight) {
+                const std::size_t i = next_chunk++;
+                results.push_back(pool.submit([first, &chunks, i, &opts] {
+                    return parseChunk(first, chunks[i], i, opts.sort_order,
+                                      [](Event ev, ChunkResult *result) {
+                                          result->events.push_back(
+                                              std::move(ev));
+                                      });
+                }));
+            }
+            auto result = results.front().get();
+            results.pop_front();
+            for (const auto &ev : result.events) { func(ev); }
+            collect(&result);
+        }
+    }
+
+    if (undefined_lines != nullptr) {
+        // The line numbers are counted only up to the undefined lines.
+        std::size_t line_number = 1;
+        const char *counted = first;
+        for (auto &line : undefined) {
+            const char *pos = first + line.offset;
+            line_number += std::count(counted, pos, '\n');
+            counted = pos;
+            line.line_number = line_number;
+        }
+        *undefined_lines = std::move(undefined);
+    }
+    return num_eve;
+}
+
+long parseEventsParallel(const std::string &fname,
+                         const std::function<void(const Event &)> &func,
+                         const ParallelOptions &opts,
+                         std::vector<UndefinedLine> *undefined_lines) {
+    const colevent::MappedFile file(fname);
+    if (!file.is_open()) { return -1; }
+    return parseEventsParallel(file.begin(), file.end(), func, opts,
+                               undefined_lines);
+}
+}  // namespace lhco
@@ -0,0 +1,56 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_LHCO_PARALLEL_READER_H_
+#define COLEVENT_SRC_LHCO_PARALLEL_READER_H_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include "lhco/event.h"
+
+namespace lhco {
+struct ParallelOptions {
+    // Number of threads parsing the events. If it is 0, the number of
+    // hardware threads is used.
+    unsigned num_threads = 0;
+    // Approximate size in bytes of the chunks parsed by each task. The
+    // chunks are split at the event header lines starting with `0`.
+    std::size_t chunk_size = std::size_t(4) << 20;
+    // If true, the events are delivered in the order of the file, and so of
+    // `Header::event_number`, one at a time on the calling thread. Otherwise,
+    // the worker threads call the function concurrently as soon as the
+    // events are parsed, so it must be thread-safe.
+    bool ordered = true;
+    // How the objects of each type in an event are ordered by pT.
+    SortOrder sort_order;
+};
+
+// A line that is not a valid LHCO line, e.g., with an object type larger
+// than 6. `lhco::parseRawEvent` stops at such a line with an empty event,
+// whereas the parallel reader discards the event, records the line, and
+// resumes at the next event header line.
+struct UndefinedLine {
+    std::size_t chunk = 0;        // index of the chunk
+    std::size_t offset = 0;       // offset in bytes from the start of input
+    std::size_t line_number = 0;  // starting from 1
+    std::string text;
+};
+
+// Parses the events in [first, last) on a thread pool and calls `func` for
+// each of them. It returns the number of events. If `undefined_lines` is
+// not null, the undefined lines are stored in it in the order of the file.
+long parseEventsParallel(const char *first, const char *last,
+                         const std::function<void(const Event &)> &func,
+                         const ParallelOptions &opts = ParallelOptions(),
+                         std::vector<UndefinedLine> *undefined_lines = nullptr);
+
+// The same as above for a memory-mapped file. It returns -1 if the file
+// cannot be opened.
+long parseEventsParallel(const std::string &fname,
+                         const std::function<void(const Event &)> &func,
+                         const ParallelOptions &opts = ParallelOptions(),
+                         std::vector<UndefinedLine> *undefined_lines = nullptr);
+}  // namespace lhco
+
+#endif  // COLEVENT_SRC_LHCO_PARALLEL_READER_H_
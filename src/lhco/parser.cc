@@ -1,62 +1,135 @@
 /* Copyright (c) 2015, 2017, Chan Beom Park <cbpark@gmail.com> */
 
 #include "lhco/parser.h"
-#include <memory>
-#include <sstream>
+#include <cstddef>
+#include <cstring>
+#include <istream>
 #include <string>
-#include <utility>
+#include "colevent_charconv.h"
 #include "object.h"
 
-using std::istringstream;
-
 namespace lhco {
-Object getObj(std::unique_ptr<istringstream> iss, const int &typ) {
+enum class LineStatus { Continue, EventEnd, Undefined };
+
+// Parses a line of an event without the newline character. The fields are
+// read as `operator>>` of `std::istream` would: once an extraction fails,
+// the following fields are zero and the trigger word is not changed.
+LineStatus parseLine(const char *first, const char *last, Header *header,
+                     RawEvent *lhco) {
+    if (std::memchr(first, '#', last - first) != nullptr) {  // comment line
+        return LineStatus::Continue;
+    }
+
+    colevent::TokenReader reader(first, last);
+    int first_digit = 0, second_digit = 0;
+    reader >> first_digit >> second_digit;
+    if (first_digit == 0) {  // line for event header
+        header->event_number = second_digit;
+        if (reader) { reader >> header->trigger_word; }
+        return LineStatus::Continue;
+    }
+    if (second_digit > 6) { return LineStatus::Undefined; }
+
     Object obj;
-    obj.typ = typ;
-    *iss >> obj;
-    return obj;
+    obj.typ = second_digit;
+    double ntrk, btag, dummy;
+    reader >> obj.eta >> obj.phi >> obj.pt >> obj.jmass >> ntrk >> btag >>
+        obj.hadem >> dummy >> dummy;
+    obj.ntrk = static_cast<int>(ntrk);
+    obj.btag = static_cast<int>(btag);
+    lhco->add_object(obj);
+    // the line for missing energy is the last line of the event.
+    return second_digit == 6 ? LineStatus::EventEnd : LineStatus::Continue;
+}
+
+// Completes the event at the end of a line. It returns false if the event
+// continues in the next line.
+bool endOfEvent(LineStatus status, const Header &header, RawEvent *lhco) {
+    switch (status) {
+    case LineStatus::EventEnd:
+        lhco->set_header(header);
+        (*lhco)(EventStatus::Fill);
+        return true;
+    case LineStatus::Undefined:
+        lhco->reset();
+        return true;
+    default:
+        return false;
+    }
 }
 
 RawEvent parseRawEvent(std::istream *is) {
-    std::string line;
-    Header header;
-    Objects objs;
     RawEvent lhco;
+    parseRawEvent(is, &lhco);
+    return lhco;
+}
 
+bool parseRawEvent(std::istream *is, RawEvent *lhco) {
+    thread_local std::string line;
+    Header header;
+    lhco->reset();
     while (std::getline(*is, line)) {
-        if (line.find("#") == std::string::npos) {
-            std::unique_ptr<istringstream> iss(new istringstream(line));
-            int first_digit = 0, second_digit = 0;
-            *iss >> first_digit >> second_digit;
-            if (first_digit == 0) {  // line for event header
-                header.event_number = second_digit;
-                *iss >> header;
-            } else if (second_digit < 6) {
-                Object obj = getObj(std::move(iss), second_digit);
-                objs.push_back(obj);
-            } else if (second_digit == 6) {  // line for missing energy
-                Object obj = getObj(std::move(iss), second_digit);
-                objs.push_back(obj);
-                lhco.set_event(header, objs);
-                break;
-            } else {  // undefined line
-                lhco(EventStatus::Empty);
-                break;
-            }
-        } else {  // comment line
-            continue;
+        const auto status = parseLine(line.data(), line.data() + line.size(),
+                                      &header, lhco);
+        if (endOfEvent(status, header, lhco)) { break; }
+    }
+    return !lhco->empty();
+}
+
+const char *parseRawEvent(const char *first, const char *last,
+                          RawEvent *lhco) {
+    const char *undefined_line;
+    return parseRawEvent(first, last, lhco, &undefined_line);
+}
+
+const char *parseRawEvent(const char *first, const char *last, RawEvent *lhco,
+                          const char **undefined_line) {
+    Header header;
+    lhco->reset();
+    *undefined_line = nullptr;
+    while (first != last) {
+        const char *next = colevent::nextLine(first, last);
+        const char *end = *(next - 1) == '\n' ? next - 1 : next;
+        const auto status = parseLine(first, end, &header, lhco);
+        if (status == LineStatus::Undefined) { *undefined_line = first; }
+        first = next;
+        if (endOfEvent(status, header, lhco)) { break; }
+    }
+    return first;
+}
+
+const char *findHeaderLine(const char *first, const char *last) {
+    for (; first != last; first = colevent::nextLine(first, last)) {
+        const char *pos = first;
+        while (pos != last && colevent::isBlank(*pos)) { ++pos; }
+        if (pos == last || *pos != '0') { continue; }
+        ++pos;
+        if (pos == last || colevent::isBlank(*pos) || *pos == '\n') {
+            return first;
         }
     }
+    return last;
+}
 
-    return lhco;
+std::size_t skipEvents(const char **pos, const char *last, std::size_t n) {
+    std::size_t num_skipped = 0;
+    for (; num_skipped != n; ++num_skipped) {
+        const char *header = findHeaderLine(*pos, last);
+        if (header == last) {  // no more events
+            *pos = last;
+            break;
+        }
+        *pos = findHeaderLine(colevent::nextLine(header, last), last);
+    }
+    return num_skipped;
 }
 
-Event parseEvent(std::istream *is) {
-    RawEvent raw_ev = parseRawEvent(is);
+Event toEvent(const RawEvent &raw_ev, const SortOrder &order) {
     Event ev;
     if (raw_ev.empty()) {
         ev(EventStatus::Empty);
     } else {
+        ev.set_header(raw_ev.header());
         for (const auto &obj : raw_ev.objects()) {
             switch (obj.typ) {
             case 0:  // photon
@@ -83,8 +156,22 @@ Event parseEvent(std::istream *is) {
                 break;
             }
         }
-        ev.sort_particles();
+        ev.sort_particles(order);
     }
     return ev;
 }
+
+Event parseEvent(std::istream *is, const SortOrder &order) {
+    thread_local RawEvent raw_ev;
+    parseRawEvent(is, &raw_ev);
+    return toEvent(raw_ev, order);
+}
+
+const char *parseEvent(const char *first, const char *last, Event *lhco,
+                       const SortOrder &order) {
+    thread_local RawEvent raw_ev;
+    const char *pos = parseRawEvent(first, last, &raw_ev);
+    *lhco = toEvent(raw_ev, order);
+    return pos;
+}
 }  // namespace lhco
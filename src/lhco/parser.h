@@ -3,12 +3,49 @@
 #ifndef COLEVENT_SRC_LHCO_PARSER_H_
 #define COLEVENT_SRC_LHCO_PARSER_H_
 
+#include <cstddef>
+#include <istream>
 #include "lhco/event.h"
 
 namespace lhco {
 RawEvent parseRawEvent(std::istream *is);
 
-Event parseEvent(std::istream *is);
+// Reads the next event into `lhco`, reusing the storage of its objects. The
+// lines are tokenized in place, so that nothing is allocated once the
+// buffers have grown. It returns false if there are no more events.
+bool parseRawEvent(std::istream *is, RawEvent *lhco);
+
+// Parses the first event in the text [first, last), e.g., of a
+// memory-mapped file, and returns the position after the event.
+const char *parseRawEvent(const char *first, const char *last,
+                          RawEvent *lhco);
+
+// The same as above, but it also sets `*undefined_line` to the start of the
+// line that is not a valid LHCO line if the event is discarded because of
+// it, and to nullptr otherwise.
+const char *parseRawEvent(const char *first, const char *last, RawEvent *lhco,
+                          const char **undefined_line);
+
+// The start of the first event header line, whose first field is `0`, in
+// [first, last). `first` must be at the start of a line. It returns `last`
+// if there is none.
+const char *findHeaderLine(const char *first, const char *last);
+
+// Moves `*pos` past the next `n` events in [*pos, last). `*pos` must be at
+// the start of a line. Only the event header lines are searched for, so that
+// the objects are not tokenized. It returns the number of events skipped,
+// which is less than `n` if the text ends before.
+std::size_t skipEvents(const char **pos, const char *last, std::size_t n);
+
+// The objects of each type are ordered by pT according to `order`. See
+// `lhco::SortOrder`.
+Event parseEvent(std::istream *is, const SortOrder &order = SortOrder());
+
+const char *parseEvent(const char *first, const char *last, Event *lhco,
+                       const SortOrder &order = SortOrder());
+
+// Sorts the objects of a raw event into the collections of `Event`.
+Event toEvent(const RawEvent &raw_ev, const SortOrder &order = SortOrder());
 }  // namespace lhco
 
 #endif  // COLEVENT_SRC_LHCO_PARSER_H_
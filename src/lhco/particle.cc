@@ -2,6 +2,7 @@
 
 #include "lhco/particle.h"
 #include <string>
+#include <type_traits>
 
 using std::string;
 using std::to_string;
@@ -11,8 +12,27 @@ using colevent::Py;
 using colevent::Pz;
 
 namespace lhco {
-string Met::show() const {
-    return "Met {pt=" + to_string(pt()) + ",phi=" + to_string(phi()) + "}";
+static_assert(std::is_trivially_copyable<Photon>::value &&
+                  std::is_trivially_copyable<Electron>::value &&
+                  std::is_trivially_copyable<Muon>::value &&
+                  std::is_trivially_copyable<Tau>::value &&
+                  std::is_trivially_copyable<Jet>::value &&
+                  std::is_trivially_copyable<Bjet>::value &&
+                  std::is_trivially_copyable<Met>::value,
+              "LHCO objects must be trivially copyable");
+
+// pt and phi, plus eta, the mass and the charge for the visible objects. The
+// members of `Tau` and `Jet` fit in the padding at the end of `Visible`.
+static_assert(sizeof(Met) == 16, "Met must hold only pt and phi");
+static_assert(sizeof(Photon) == 40 && sizeof(Electron) == 40 &&
+                  sizeof(Tau) == 40 && sizeof(Jet) == 40,
+              "LHCO objects must not grow");
+static_assert(sizeof(Muon) == 48 && sizeof(Bjet) == 48,
+              "LHCO objects must not grow");
+
+string show(const Met &met) {
+    return "Met {pt=" + to_string(met.pt()) + ",phi=" + to_string(met.phi()) +
+           "}";
 }
 
 string show_pt_eta_phi(const Visible &p) {
@@ -29,9 +49,8 @@ string show_e_px_py_pz(const Visible &p) {
            ",py=" + to_string(p.py()) + ",pz=" + to_string(p.pz());
 }
 
-string Visible::show() const {
-    return "Visible {" + show_pt_eta_phi_m(*this) + "," +
-           show_e_px_py_pz(*this) + "}";
+string show(const Visible &p) {
+    return "Visible {" + show_pt_eta_phi_m(p) + "," + show_e_px_py_pz(p) + "}";
 }
 
 Visible &Visible::operator+=(const Visible &rhs) {
@@ -43,35 +62,34 @@ Visible &Visible::operator+=(const Visible &rhs) {
     return *this;
 }
 
-string Photon::show() const {
-    return "Photon {" + show_pt_eta_phi(*this) + "}";
-}
+string show(const Photon &p) { return "Photon {" + show_pt_eta_phi(p) + "}"; }
 
-string Electron::show() const {
-    return "Electron {" + show_pt_eta_phi(*this) +
-           ",charge=" + to_string(charge()) + "}";
+string show(const Electron &p) {
+    return "Electron {" + show_pt_eta_phi(p) +
+           ",charge=" + to_string(p.charge()) + "}";
 }
 
-string Muon::show() const {
-    return "Muon {" + show_pt_eta_phi_m(*this) +
-           ",charge=" + to_string(charge()) + ",ptiso=" + to_string(ptiso()) +
-           ",etrat=" + to_string(etrat()) + "}";
+string show(const Muon &p) {
+    return "Muon {" + show_pt_eta_phi_m(p) +
+           ",charge=" + to_string(p.charge()) +
+           ",ptiso=" + to_string(p.ptiso()) +
+           ",etrat=" + to_string(p.etrat()) + "}";
 }
 
-string Tau::show() const {
-    return "Tau {" + show_pt_eta_phi_m(*this) +
-           ",charge=" + to_string(charge()) + ",prong=" + to_string(prong()) +
-           "}";
+string show(const Tau &p) {
+    return "Tau {" + show_pt_eta_phi_m(p) +
+           ",charge=" + to_string(p.charge()) +
+           ",prong=" + to_string(p.prong()) + "}";
 }
 
-string Jet::show() const {
-    return "Jet {" + show_pt_eta_phi_m(*this) +
-           ",ntrk=" + to_string(num_track()) + "}";
+string show(const Jet &p) {
+    return "Jet {" + show_pt_eta_phi_m(p) +
+           ",ntrk=" + to_string(p.num_track()) + "}";
 }
 
-string Bjet::show() const {
-    return "Bjet {" + show_pt_eta_phi_m(*this) +
-           ",ntrk=" + to_string(num_track()) + ",btag=" + to_string(btag()) +
-           "}";
+string show(const Bjet &p) {
+    return "Bjet {" + show_pt_eta_phi_m(p) +
+           ",ntrk=" + to_string(p.num_track()) +
+           ",btag=" + to_string(p.btag()) + "}";
 }
 }  // namespace lhco
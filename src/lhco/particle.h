@@ -4,64 +4,53 @@
 #define COLEVENT_SRC_LHCO_PARTICLE_H_
 
 #include <cmath>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "colevent_kinematics.h"
 
 namespace lhco {
+// The objects have no virtual functions and are trivially copyable, so that
+// the vectors of them in `lhco::Event` are contiguous arrays of plain data.
+// `show` is a free function overloaded for each type.
+//
+// Only pt, eta, phi and the mass are stored. The Cartesian components are
+// computed from them in the accessors, with the same expressions as the
+// constructors did, so that a cut on pt and eta alone does not evaluate any
+// trigonometric function, and the const accessors never write to the object.
 class Particle {
 private:
     double pt_ = 0.0;
     double phi_ = 0.0;
-    double px_ = 0.0;
-    double py_ = 0.0;
 
 public:
     Particle() {}
     Particle(const colevent::Pt &pt, const colevent::Phi &phi)
-        : pt_{pt.value},
-          phi_{phi.value},
-          px_{pt.value * std::cos(phi.value)},
-          py_{pt.value * std::sin(phi.value)} {}
-    virtual ~Particle() {}
+        : pt_{pt.value}, phi_{phi.value} {}
 
     double pt() const { return pt_; }
     double phi() const { return phi_; }
-    double px() const { return px_; }
-    double py() const { return py_; }
-
-    virtual std::string show() const = 0;
+    double px() const { return pt_ * std::cos(phi_); }
+    double py() const { return pt_ * std::sin(phi_); }
 };
 
-inline std::string show(const Particle &p) { return p.show(); }
-
 struct Met : public Particle {
     Met() {}
     Met(const colevent::Pt &pt, const colevent::Phi &phi) : Particle(pt, phi) {}
-    ~Met() {}
-
-    std::string show() const;
 };
 
+std::string show(const Met &met);
+
 class Visible : public Particle {
 public:
-    enum class Charge { Positive, Negative, Neutral };
+    enum class Charge : std::int8_t { Positive, Negative, Neutral };
 
 private:
     double eta_ = 0.0;
     double m_ = 0.0;
-    double pz_ = 0.0;
-    double e_ = 0.0;
     Charge q_ = Charge::Neutral;
 
 protected:
-    void set_energy(double m) {
-        if (m > 0.0) {
-            e_ = std::sqrt(pt() * pt() + pz_ * pz_ + m * m);
-        } else {
-            e_ = std::sqrt(pt() * pt() + pz_ * pz_);
-        }
-    }
     void set_charge(int q) {
         if (q > 0) {
             q_ = Charge::Positive;
@@ -77,18 +66,14 @@ public:
 
     Visible(const colevent::Pt &pt, const colevent::Eta &eta,
             const colevent::Phi &phi, const colevent::Mass &m)
-        : Particle{pt, phi},
-          eta_{eta.value},
-          m_{m.value},
-          pz_{pt.value * std::sinh(eta.value)} {
-        set_energy(m.value);
-    }
+        : Particle{pt, phi}, eta_{eta.value}, m_{m.value} {}
 
+    // The components are converted to pt, eta, phi and the mass, so that the
+    // accessors return them only within rounding, and not at all if pt is 0.
+    // Sum many four-momenta as `colevent::FourMomentum`, like `invariantMass`.
     Visible(const colevent::Energy &e, const colevent::Px &px,
             const colevent::Py &py, const colevent::Pz &pz)
-        : Particle{colevent::Pt{px, py}, colevent::Phi{px, py}},
-          pz_{pz.value},
-          e_{e.value} {
+        : Particle{colevent::Pt{px, py}, colevent::Phi{px, py}} {
         colevent::Eta eta(px, py, pz);
         eta_ = eta.value;
         colevent::FourMomentum p{e, px, py, pz};
@@ -97,20 +82,18 @@ public:
 
     Visible(const colevent::Pt &pt, const colevent::Eta &eta,
             const colevent::Phi &phi, const colevent::Mass &m, const int &ntrk)
-        : Particle{pt, phi},
-          eta_{eta.value},
-          m_{m.value},
-          pz_{pt.value * std::sinh(eta.value)} {
-        set_energy(m.value);
+        : Visible(pt, eta, phi, m) {
         set_charge(ntrk);
     }
 
-    virtual ~Visible() {}
-
     double eta() const { return eta_; }
     double mass() const { return m_; }
-    double pz() const { return pz_; }
-    double energy() const { return e_; }
+    double pz() const { return pt() * std::sinh(eta_); }
+    double energy() const {
+        const double p_z = pz();
+        if (m_ > 0.0) { return std::sqrt(pt() * pt() + p_z * p_z + m_ * m_); }
+        return std::sqrt(pt() * pt() + p_z * p_z);
+    }
     int charge() const {
         switch (q_) {
         case Charge::Positive:
@@ -122,7 +105,6 @@ public:
         }
     }
 
-    virtual std::string show() const;
     friend bool operator<(const Visible &lhs, const Visible &rhs) {
         return lhs.pt() < rhs.pt();
     }
@@ -135,6 +117,8 @@ public:
     }
 };
 
+std::string show(const Visible &p);
+
 using Visibles = std::vector<Visible>;
 
 class Photon : public Visible {
@@ -143,54 +127,48 @@ public:
     Photon(const colevent::Pt &pt, const colevent::Eta &eta,
            const colevent::Phi &phi, const colevent::Mass &m)
         : Visible(pt, eta, phi, m) {}
-    ~Photon() {}
-
-    std::string show() const;
 };
 
+std::string show(const Photon &p);
+
 struct Electron : public Visible {
     Electron() {}
     Electron(const colevent::Pt &pt, const colevent::Eta &eta,
              const colevent::Phi &phi, const colevent::Mass &m, const int ntrk)
         : Visible(pt, eta, phi, m, ntrk) {}
-    ~Electron() {}
-
-    std::string show() const;
 };
 
+std::string show(const Electron &p);
+
 class Muon : public Visible {
 private:
-    double ptiso_;
-    double etrat_;
-
-protected:
-    void set_ptiso_etrat(double hadem) {
-        ptiso_ = std::trunc(hadem);
-        etrat_ = hadem - ptiso_;
-    }
+    // The integer part is the isolation pT and the fractional part is the
+    // ratio of the transverse energies. Both are derived when accessed.
+    double hadem_ = 0.0;
 
 public:
-    Muon() : ptiso_(0.0), etrat_(0.0) {}
+    Muon() {}
     Muon(const colevent::Pt &pt, const colevent::Eta &eta,
          const colevent::Phi &phi, const colevent::Mass &m, const int ntrk,
          const double hadem)
-        : Visible(pt, eta, phi, m, ntrk) {
-        set_ptiso_etrat(hadem);
-    }
-    ~Muon() {}
-
-    double ptiso() const { return ptiso_; }
-    double etrat() const { return etrat_; }
+        : Visible(pt, eta, phi, m, ntrk), hadem_(hadem) {}
 
-    std::string show() const;
+    double ptiso() const { return std::trunc(hadem_); }
+    double etrat() const { return hadem_ - std::trunc(hadem_); }
 };
 
+std::string show(const Muon &p);
+
 class Tau : public Visible {
 public:
-    enum class TauProng : int { OneProng = 1, ThreeProng = 3, Unknown = 0 };
+    enum class TauProng : std::int8_t {
+        OneProng = 1,
+        ThreeProng = 3,
+        Unknown = 0
+    };
 
 private:
-    TauProng prong_;
+    TauProng prong_ = TauProng::Unknown;
 
 protected:
     void set_prong(int ntrk) {
@@ -204,45 +182,43 @@ protected:
     }
 
 public:
-    Tau() : prong_(TauProng::Unknown) {}
+    Tau() {}
     Tau(const colevent::Pt &pt, const colevent::Eta &eta,
         const colevent::Phi &phi, const colevent::Mass &m, const int ntrk)
         : Visible(pt, eta, phi, m) {
         ntrk > 0 ? set_charge(1) : set_charge(-1);
         set_prong(ntrk);
     }
-    ~Tau() {}
 
     int prong() const { return static_cast<int>(prong_); }
-
-    std::string show() const;
 };
 
+std::string show(const Tau &p);
+
 class Jet : public Visible {
 private:
-    int num_track_;
+    int num_track_ = 0;
 
 public:
-    Jet() : num_track_(0) {}
+    Jet() {}
     Jet(const colevent::Pt &pt, const colevent::Eta &eta,
         const colevent::Phi &phi, const colevent::Mass &m, const int ntrk)
         : Visible(pt, eta, phi, m), num_track_(ntrk) {}
-    virtual ~Jet() {}
 
     int num_track() const { return num_track_; }
-
-    virtual std::string show() const;
 };
 
+std::string show(const Jet &p);
+
 class Bjet : public Jet {
 public:
-    enum class BTag : int { Loose = 1, Tight = 2, Unknown = 0 };
+    enum class BTag : std::int8_t { Loose = 1, Tight = 2, Unknown = 0 };
 
 private:
-    BTag btag_;
+    BTag btag_ = BTag::Unknown;
 
 public:
-    Bjet() : btag_(BTag::Unknown) {}
+    Bjet() {}
     Bjet(const colevent::Pt &pt, const colevent::Eta &eta,
          const colevent::Phi &phi, const colevent::Mass &m, const int ntrk,
          const int btag)
@@ -255,12 +231,11 @@ public:
             btag_ = BTag::Unknown;
         }
     }
-    ~Bjet() {}
 
     int btag() const { return static_cast<int>(btag_); }
-
-    std::string show() const;
 };
+
+std::string show(const Bjet &p);
 }  // namespace lhco
 
 #endif  // COLEVENT_SRC_LHCO_PARTICLE_H_
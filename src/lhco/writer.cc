@@ -0,0 +1,54 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhco/writer.h"
+#include <ostream>
+#include <string>
+#include "colevent_charconv.h"
+
+using colevent::appendFixed;
+using colevent::appendInt;
+
+namespace lhco {
+void render(const Header &h, std::string *out) {
+    appendInt(out, h.event_number, 14);
+    appendInt(out, h.trigger_word, 7);
+}
+
+void render(const Object &obj, std::string *out) {
+    appendInt(out, obj.typ, 5);
+    appendFixed(out, obj.eta, 3, 9);
+    appendFixed(out, obj.phi, 3, 7);
+    appendFixed(out, obj.pt, 2, 8);
+    appendFixed(out, obj.jmass, 2, 8);
+    appendFixed(out, static_cast<double>(obj.ntrk), 1, 6);
+    appendFixed(out, static_cast<double>(obj.btag), 1, 6);
+    appendFixed(out, obj.hadem, 2, 9);
+}
+
+void render(const RawEvent &ev, std::string *out) {
+    appendInt(out, 0, 3);
+    render(ev.header(), out);
+    out->push_back('\n');
+    int counter = 1;
+    for (const auto &obj : ev.objects()) {
+        appendInt(out, counter, 3);
+        render(obj, out);
+        out->append("   0.0   0.0");  // two dummy fields
+        if (obj.typ != 6) { out->push_back('\n'); }
+        ++counter;
+    }
+}
+
+Writer::Writer(std::ostream *os, std::size_t flush_size)
+    : os_(os), flush_size_(flush_size) {
+    // Room for one more event past the flush size.
+    buf_.reserve(flush_size_ + (1 << 16));
+}
+
+void Writer::flush() {
+    if (!buf_.empty()) {
+        os_->write(buf_.data(), static_cast<std::streamsize>(buf_.size()));
+        buf_.clear();
+    }
+}
+}  // namespace lhco
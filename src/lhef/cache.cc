@@ -0,0 +1,205 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhef/cache.h"
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "colevent_mapped_file.h"
+#include "lhef/lhef.h"
+#include "lhef/mapped_reader.h"
+#include "lhef/writer.h"
+
+using colevent::bytesOf;
+
+namespace lhef {
+namespace {
+enum Column : std::size_t {
+    kNup,
+    kIdprup,
+    kNumParticles,
+    kXwgtup,
+    kScalup,
+    kAqedup,
+    kAqcdup,
+    kIdup,
+    kIstup,
+    kMothup1,
+    kMothup2,
+    kIcolup1,
+    kIcolup2,
+    kPx,
+    kPy,
+    kPz,
+    kEnergy,
+    kMass,
+    kVtimup,
+    kSpinup,
+    kNumColumns
+};
+
+// Whether the columns of a row group have the sizes of the schema.
+bool isValid(const colevent::RowGroup &group) {
+    const auto n = group.num_events, m = group.num_rows;
+    bool valid = group.hasColumn<std::int32_t>(kNup, n) &&
+                 group.hasColumn<std::int32_t>(kIdprup, n) &&
+                 group.hasColumn<std::uint32_t>(kNumParticles, n);
+    for (std::size_t i = kXwgtup; i <= kAqcdup; ++i) {
+        valid = valid && group.hasColumn<double>(i, n);
+    }
+    for (std::size_t i = kIdup; i <= kIcolup2; ++i) {
+        valid = valid && group.hasColumn<std::int32_t>(i, m);
+    }
+    for (std::size_t i = kPx; i <= kSpinup; ++i) {
+        valid = valid && group.hasColumn<double>(i, m);
+    }
+    if (!valid) { return false; }
+
+    const auto num_particles = group.column<std::uint32_t>(kNumParticles);
+    std::uint64_t num_rows = 0;
+    for (std::uint64_t i = 0; i < n; ++i) { num_rows += num_particles[i]; }
+    return num_rows == m;
+}
+}  // namespace
+
+CacheWriter::CacheWriter(const std::string &fname, std::string_view metadata,
+                         std::size_t group_size)
+    : out_(fname, colevent::EventFormat::LHEF, kNumColumns, metadata),
+      group_size_(group_size > 0 ? group_size : 1) {}
+
+bool CacheWriter::add(const Event &lhe) {
+    if (!isOpen()) { return false; }
+    const EventInfo &evinfo = lhe.eventInfo();
+    nup_.push_back(evinfo.nup);
+    idprup_.push_back(evinfo.idprup);
+    num_particles_.push_back(
+        static_cast<std::uint32_t>(lhe.particles().size()));
+    xwgtup_.push_back(evinfo.xwgtup);
+    scalup_.push_back(evinfo.scalup);
+    aqedup_.push_back(evinfo.aqedup);
+    aqcdup_.push_back(evinfo.aqcdup);
+    for (const auto &p : lhe.particles()) {
+        idup_.push_back(p.pid());
+        istup_.push_back(p.status());
+        mothup1_.push_back(p.mother().first);
+        mothup2_.push_back(p.mother().second);
+        icolup1_.push_back(p.color().first);
+        icolup2_.push_back(p.color().second);
+        px_.push_back(p.px());
+        py_.push_back(p.py());
+        pz_.push_back(p.pz());
+        energy_.push_back(p.energy());
+        mass_.push_back(p.mass());
+        vtimup_.push_back(p.decayLength());
+        spinup_.push_back(p.spin());
+    }
+    return nup_.size() < group_size_ || writeRowGroup();
+}
+
+bool CacheWriter::writeRowGroup() {
+    const bool ok = out_.writeRowGroup(
+        nup_.size(), idup_.size(),
+        {bytesOf(nup_), bytesOf(idprup_), bytesOf(num_particles_),
+         bytesOf(xwgtup_), bytesOf(scalup_), bytesOf(aqedup_),
+         bytesOf(aqcdup_), bytesOf(idup_), bytesOf(istup_),
+         bytesOf(mothup1_), bytesOf(mothup2_), bytesOf(icolup1_),
+         bytesOf(icolup2_), bytesOf(px_), bytesOf(py_), bytesOf(pz_),
+         bytesOf(energy_), bytesOf(mass_), bytesOf(vtimup_),
+         bytesOf(spinup_)});
+    for (auto *column : {&nup_, &idprup_, &idup_, &istup_, &mothup1_,
+                         &mothup2_, &icolup1_, &icolup2_}) {
+        column->clear();
+    }
+    for (auto *column : {&xwgtup_, &scalup_, &aqedup_, &aqcdup_, &px_, &py_,
+                         &pz_, &energy_, &mass_, &vtimup_, &spinup_}) {
+        column->clear();
+    }
+    num_particles_.clear();
+    return ok;
+}
+
+bool CacheWriter::close() {
+    if (!isOpen()) { return false; }
+    const bool ok = nup_.empty() || writeRowGroup();
+    return out_.close() && ok;
+}
+
+CacheReader::CacheReader(const std::string &fname) : file_(fname) {
+    valid_ = file_.is_open() &&
+             file_.format() == colevent::EventFormat::LHEF &&
+             file_.numColumns() == kNumColumns;
+    for (const auto &group : file_.rowGroups()) {
+        valid_ = valid_ && isValid(group);
+    }
+}
+
+bool CacheReader::next(Event *lhe) {
+    if (!valid_) { return false; }
+    const auto &groups = file_.rowGroups();
+    while (group_ < groups.size() && event_ == groups[group_].num_events) {
+        ++group_;
+        event_ = row_ = 0;
+    }
+    if (group_ == groups.size()) {
+        (*lhe)(Event::EventStatus::Empty);
+        return false;
+    }
+
+    const auto &g = groups[group_];
+    const std::size_t i = event_;
+    lhe->resetEvent(EventInfo(g.column<std::int32_t>(kNup)[i],
+                              g.column<std::int32_t>(kIdprup)[i],
+                              g.column<double>(kXwgtup)[i],
+                              g.column<double>(kScalup)[i],
+                              g.column<double>(kAqedup)[i],
+                              g.column<double>(kAqcdup)[i]));
+    const auto num_particles = g.column<std::uint32_t>(kNumParticles)[i];
+    for (std::size_t line = 1; line <= num_particles; ++line) {
+        const std::size_t k = row_ + line - 1;
+        lhe->setParticle(static_cast<int>(line),
+                         Particle(g.column<std::int32_t>(kIdup)[k],
+                                  g.column<std::int32_t>(kIstup)[k],
+                                  g.column<std::int32_t>(kMothup1)[k],
+                                  g.column<std::int32_t>(kMothup2)[k],
+                                  g.column<std::int32_t>(kIcolup1)[k],
+                                  g.column<std::int32_t>(kIcolup2)[k],
+                                  g.column<double>(kPx)[k],
+                                  g.column<double>(kPy)[k],
+                                  g.column<double>(kPz)[k],
+                                  g.column<double>(kEnergy)[k],
+                                  g.column<double>(kMass)[k],
+                                  g.column<double>(kVtimup)[k],
+                                  g.column<double>(kSpinup)[k]));
+    }
+    ++event_;
+    row_ += num_particles;
+    return true;
+}
+
+bool convertToCache(const std::string &fname, const std::string &cache_fname,
+                    std::size_t group_size) {
+    MappedReader reader(fname);
+    const colevent::MappedFile file(fname);
+    if (!reader || !file.is_open()) { return false; }
+    const char *first = findEventTag(file.begin(), file.end());
+    CacheWriter writer(cache_fname,
+                       std::string_view(file.begin(), first - file.begin()),
+                       group_size);
+    if (!writer.isOpen()) { return false; }
+    for (Event lhe; parseEvent(&reader, &lhe);) {
+        if (!writer.add(lhe)) { return false; }
+    }
+    return writer.close();
+}
+
+bool convertToText(const std::string &cache_fname, std::ostream *os) {
+    CacheReader reader(cache_fname);
+    if (!reader.isOpen()) { return false; }
+    Writer writer(os);
+    writer << reader.metadata();
+    for (Event lhe; reader.next(&lhe);) { writer << lhe << '\n'; }
+    writer << closingLine() << '\n';
+    writer.flush();
+    return static_cast<bool>(*os);
+}
+}  // namespace lhef
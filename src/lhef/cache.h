@@ -0,0 +1,82 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_LHEF_CACHE_H_
+#define COLEVENT_SRC_LHEF_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "colevent_columnar.h"
+#include "lhef/event.h"
+
+namespace lhef {
+// Writes events to a columnar cache file (see `colevent_columnar.h`) in row
+// groups of `group_size` events. The columns are the fields of `EventInfo`
+// with the number of particles of each event, and the fields of the
+// particles: IDUP, ISTUP, MOTHUP, ICOLUP, PUP, VTIMUP and SPINUP. `metadata`
+// is kept as it is, e.g., the text before the first event of the input.
+class CacheWriter {
+private:
+    colevent::ColumnarWriter out_;
+    std::size_t group_size_;
+    std::vector<std::int32_t> nup_, idprup_;
+    std::vector<std::uint32_t> num_particles_;
+    std::vector<double> xwgtup_, scalup_, aqedup_, aqcdup_;
+    std::vector<std::int32_t> idup_, istup_, mothup1_, mothup2_, icolup1_,
+        icolup2_;
+    std::vector<double> px_, py_, pz_, energy_, mass_, vtimup_, spinup_;
+
+public:
+    explicit CacheWriter(const std::string &fname,
+                         std::string_view metadata = {},
+                         std::size_t group_size = 1 << 14);
+    ~CacheWriter() { close(); }
+
+    bool isOpen() const { return out_.is_open(); }
+
+    bool add(const Event &lhe);
+
+    // Writes the remaining events and the footer.
+    bool close();
+
+private:
+    bool writeRowGroup();
+};
+
+// Reads the events of a cache file written by `CacheWriter` in place from
+// the memory-mapped file.
+class CacheReader {
+private:
+    colevent::ColumnarFile file_;
+    bool valid_ = false;
+    std::size_t group_ = 0;
+    std::size_t event_ = 0;  // in the current row group
+    std::size_t row_ = 0;    // in the current row group
+
+public:
+    explicit CacheReader(const std::string &fname);
+
+    // False if the file cannot be opened or is not an LHEF cache.
+    bool isOpen() const { return valid_; }
+    std::uint64_t size() const { return file_.numEvents(); }
+    std::string_view metadata() const { return file_.metadata(); }
+
+    // Reads the next event into `lhe`, reusing its storage. It returns false
+    // at the end of the file.
+    bool next(Event *lhe);
+};
+
+// Converts a text file, which is not compressed, to a cache file. It
+// returns false if either file cannot be opened.
+bool convertToCache(const std::string &fname, const std::string &cache_fname,
+                    std::size_t group_size = 1 << 14);
+
+// Writes the text of a cache file, i.e., its metadata followed by the events
+// rendered as by `operator<<`.
+bool convertToText(const std::string &cache_fname, std::ostream *os);
+}  // namespace lhef
+
+#endif  // COLEVENT_SRC_LHEF_CACHE_H_
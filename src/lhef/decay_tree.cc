@@ -0,0 +1,143 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhef/decay_tree.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace lhef {
+template <typename F>
+void forEachMother(const Particle &p, int nup, F func) {
+    const auto mothers = p.mother();
+    const int m1 = mothers.first, m2 = mothers.second;
+    auto valid = [nup](int l) { return l >= 1 && l <= nup; };
+    if (m1 > 0 && m2 > m1) {
+        for (int l = m1; l <= m2; ++l) {
+            if (valid(l)) { func(l); }
+        }
+    } else {
+        if (valid(m1)) { func(m1); }
+        if (m2 != m1 && valid(m2)) { func(m2); }
+    }
+}
+
+void DecayTree::build(const Event &lhe) {
+    const auto &ps = lhe.particles();
+    nup_ = static_cast<int>(ps.size());
+    words_ = (ps.size() + 63) / 64;
+
+    // daughters in the compressed sparse row format.
+    offsets_.assign(nup_ + 1, 0);
+    for (const auto &p : ps) {
+        forEachMother(p, nup_, [this](int m) { ++offsets_[m]; });
+    }
+    for (int l = 1; l <= nup_; ++l) { offsets_[l] += offsets_[l - 1]; }
+    children_.resize(offsets_[nup_]);
+    for (int l = nup_; l >= 1; --l) {
+        forEachMother(ps[l - 1], nup_,
+                      [this, l](int m) { children_[--offsets_[m]] = l; });
+    }
+    // offsets_[m] now points to the first daughter of the line m.
+    for (int l = 0; l < nup_; ++l) { offsets_[l] = offsets_[l + 1]; }
+    offsets_[nup_] = static_cast<int>(children_.size());
+
+    // descendants, filled from the bottom of the tree. A line is visited
+    // only once, so that a broken (cyclic) mother record cannot loop.
+    descendants_.assign(nup_ * words_, 0);
+    std::vector<char> state(nup_, 0);  // 0: new, 1: visiting, 2: done
+    std::vector<std::pair<int, int>> stack;
+    for (int root = 1; root <= nup_; ++root) {
+        if (state[root - 1]) { continue; }
+        stack.push_back({root, offsets_[root - 1]});
+        state[root - 1] = 1;
+        while (!stack.empty()) {
+            auto &top = stack.back();
+            const int l = top.first;
+            if (top.second < offsets_[l]) {
+                const int c = children_[top.second++];
+                if (state[c - 1] == 0) {
+                    state[c - 1] = 1;
+                    stack.push_back({c, offsets_[c - 1]});
+                }
+                continue;
+            }
+            std::uint64_t *bits = &descendants_[(l - 1) * words_];
+            for (int i = offsets_[l - 1]; i < offsets_[l]; ++i) {
+                const int c = children_[i];
+                const auto bit = static_cast<std::size_t>(c - 1);
+                bits[bit / 64] |= std::uint64_t(1) << (bit % 64);
+                if (state[c - 1] == 2) {
+                    const std::uint64_t *cbits = &descendants_[bit * words_];
+                    for (std::size_t w = 0; w < words_; ++w) {
+                        bits[w] |= cbits[w];
+                    }
+                }
+            }
+            state[l - 1] = 2;
+            stack.pop_back();
+        }
+    }
+
+    final_states_.assign(words_, 0);
+    for (int l = 1; l <= nup_; ++l) {
+        if (ps[l - 1].status() == 1) {
+            const auto bit = static_cast<std::size_t>(l - 1);
+            final_states_[bit / 64] |= std::uint64_t(1) << (bit % 64);
+        }
+    }
+
+    // the same walk along the first mothers as `lhef::ancestor`.
+    auto first_mother = [&ps, this](int l) {
+        const int m = ps[l - 1].mother().first;
+        return valid(m) ? m : 1;
+    };
+    ancestors_.assign(nup_, 0);
+    for (int l = 1; l <= nup_; ++l) {
+        int q = l;
+        for (int step = 0; step < nup_; ++step) {
+            const int m = first_mother(q);
+            if (ps[m - 1].mother().first == 1) {
+                ancestors_[l - 1] = m;
+                break;
+            }
+            q = m;
+        }
+    }
+}
+
+ParticleLines DecayTree::finalDaughterLines(int line) const {
+    ParticleLines lines;
+    if (!valid(line)) { return lines; }
+    const std::uint64_t *bits = &descendants_[(line - 1) * words_];
+    for (std::size_t w = 0; w < words_; ++w) {
+        for (std::uint64_t word = bits[w] & final_states_[w]; word != 0;
+             word &= word - 1) {
+            int bit = 0;
+            while (!((word >> bit) & 1U)) { ++bit; }
+            lines.push_back(static_cast<int>(w * 64 + bit) + 1);
+        }
+    }
+    return lines;
+}
+
+Particles daughters(int pline, const Event &lhe, const DecayTree &tree) {
+    Particles ps;
+    const auto &entry = lhe.particleEntries();
+    for (const int l : tree.daughterLines(pline)) { ps.push_back(entry.at(l)); }
+    return ps;
+}
+
+Particles finalDaughters(int pline, const Event &lhe, const DecayTree &tree) {
+    Particles ps;
+    const auto &entry = lhe.particleEntries();
+    for (const int l : tree.finalDaughterLines(pline)) {
+        ps.push_back(entry.at(l));
+    }
+    return ps;
+}
+
+Particle ancestor(int pline, const Event &lhe, const DecayTree &tree) {
+    const int l = tree.ancestorLine(pline);
+    return l > 0 ? lhe.particleEntries().at(l) : Particle();
+}
+}  // namespace lhef
@@ -0,0 +1,98 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_LHEF_DECAY_TREE_H_
+#define COLEVENT_SRC_LHEF_DECAY_TREE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "lhef/event.h"
+
+namespace lhef {
+// Index of the decay tree of an event, built once from the mother lines
+// (`mothup`) of the particles. Both mothers are taken into account: a
+// particle with `mothup = (m1, m2)` is a daughter of all the lines from m1 to
+// m2 if m1 <= m2, and of m1 and m2 otherwise. The lines are numbered from 1.
+class DecayTree {
+public:
+    // Lines of the daughters of a particle.
+    class Lines {
+    private:
+        const int *first_;
+        const int *last_;
+
+    public:
+        Lines(const int *first, const int *last) : first_(first), last_(last) {}
+        const int *begin() const { return first_; }
+        const int *end() const { return last_; }
+        std::size_t size() const { return last_ - first_; }
+        bool empty() const { return first_ == last_; }
+    };
+
+private:
+    int nup_ = 0;
+    // Daughters of the line l are children_[offsets_[l - 1]] ...
+    // children_[offsets_[l] - 1].
+    std::vector<int> offsets_;
+    std::vector<int> children_;
+    // Bitset of all the descendants of each line, `words_` words per line.
+    std::size_t words_ = 0;
+    std::vector<std::uint64_t> descendants_;
+    // Bitset of the final-state lines.
+    std::vector<std::uint64_t> final_states_;
+    // See `lhef::ancestor`. It is 0 if there is no such ancestor.
+    std::vector<int> ancestors_;
+
+public:
+    DecayTree() {}
+    explicit DecayTree(const Event &lhe) { build(lhe); }
+
+    // Rebuilds the index for the event, reusing the allocated storage.
+    void build(const Event &lhe);
+
+    int size() const { return nup_; }
+
+    Lines daughterLines(int line) const {
+        if (!valid(line)) { return {nullptr, nullptr}; }
+        const int *first = children_.data();
+        return {first + offsets_[line - 1], first + offsets_[line]};
+    }
+
+    bool isDescendant(int line, int of) const {
+        if (!valid(line) || !valid(of)) { return false; }
+        const auto bit = static_cast<std::size_t>(line - 1);
+        return (descendants_[(of - 1) * words_ + bit / 64] >> (bit % 64)) & 1U;
+    }
+
+    ParticleLines finalDaughterLines(int line) const;
+
+    int ancestorLine(int line) const {
+        return valid(line) ? ancestors_[line - 1] : 0;
+    }
+
+private:
+    bool valid(int line) const { return line >= 1 && line <= nup_; }
+};
+
+// The daughters of the line from the index. Unlike `lhef::daughters(pline,
+// lhe)`, which selects the particles whose first mother is `pline`, these
+// include the particles reaching it through their second mother or the range
+// of their mothers, e.g., both top quarks of `mothup = (1, 2)` for the line 2.
+Particles daughters(int pline, const Event &lhe, const DecayTree &tree);
+
+// The final-state descendants of the line along all the mothers. Unlike
+// `lhef::finalDaughters(pline, lhe)`, which follows only the first mothers,
+// these include the descendants through the second mothers. For the beam
+// lines 1 and 2 they are all the final states produced from them, whereas
+// `lhef::finalDaughters` returns none.
+Particles finalDaughters(int pline, const Event &lhe, const DecayTree &tree);
+
+// The same particle as `lhef::ancestor` of the particle at the line, i.e.,
+// the first one along the first mothers whose first mother is the line 1.
+// Where `lhef::ancestor` never returns, e.g., for the beams, for a particle
+// produced directly from them, or for a cyclic mother record, it returns
+// `Particle()`.
+Particle ancestor(int pline, const Event &lhe, const DecayTree &tree);
+}  // namespace lhef
+
+#endif  // COLEVENT_SRC_LHEF_DECAY_TREE_H_
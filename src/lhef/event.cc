@@ -1,24 +1,34 @@
 /* Copyright (c) 2014-2015, 2017, Chan Beom Park <cbpark@gmail.com> */
 
 #include "lhef/event.h"
-#include <algorithm>
 #include <iomanip>
 #include <ios>
 #include <iostream>
-#include <map>
+#include <utility>
 
 using std::setw;
 using std::to_string;
 
 namespace lhef {
-Particles Event::particles() const {
-    Particles ps;
-    const auto entries = particleEntries();
-    ps.reserve(entries.size());
-    std::for_each(
-        entries.cbegin(), entries.cend(),
-        [&ps](const EventEntry::value_type &e) { ps.push_back(e.second); });
-    return ps;
+void Event::resetEvent(const EventInfo &evinfo) {
+    status_ = EventStatus::Fill;
+    event_.first = evinfo;
+    event_.second.resize(evinfo.nup > 0 ? evinfo.nup : 0);
+}
+
+void Event::setParticle(int line, const Particle &p) {
+    if (event_.second.count(line)) {
+        event_.second.at(line) = p;
+    } else {
+        event_.second.insert({line, p});
+    }
+}
+
+void EventEntry::insert(const std::pair<int, Particle> &entry) {
+    if (entry.first < 1) { return; }
+    const auto line = static_cast<std::size_t>(entry.first);
+    if (particles_.size() < line) { particles_.resize(line); }
+    particles_[line - 1] = entry.second;
 }
 
 std::istream &operator>>(std::istream &is, GlobalInfo &info) {
@@ -98,8 +108,10 @@ std::string show(const EventInfo &evinfo) {
 
 std::string show(const EventEntry &entry) {
     std::string entry_str = "[";
-    for (const auto &e : entry) {
-        entry_str += "(" + to_string(e.first) + "," + show(e.second) + "),";
+    int line = 1;
+    for (const auto &p : entry) {
+        entry_str += "(" + to_string(line) + "," + show(p) + "),";
+        ++line;
     }
     entry_str.pop_back();
     entry_str += "]";
@@ -108,11 +120,7 @@ std::string show(const EventEntry &entry) {
 
 std::ostream &operator<<(std::ostream &os, const Event &ev) {
     os << "<event>\n" << ev.event_.first << '\n';
-
-    // EventEntry is unordered_map. It has to be ordered.
-    const std::map<int, Particle> entry_ordered(ev.event_.second.cbegin(),
-                                                ev.event_.second.cend());
-    for (const auto &entry : entry_ordered) { os << entry.second << '\n'; }
+    for (const auto &p : ev.event_.second) { os << p << '\n'; }
     os << "</event>";
     return os;
 }
@@ -4,8 +4,8 @@
 #define COLEVENT_SRC_LHEF_EVENT_H_
 
 #include <iostream>
+#include <cstddef>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "lhef/particle.h"
@@ -84,7 +84,48 @@ struct EventInfo {
 
 std::string show(const EventInfo &evinfo);
 
-using EventEntry = std::unordered_map<int, Particle>;
+using ParticleLines = std::vector<int>;
+
+// Particle entries of an event. The particle lines of LHEF are numbered
+// densely from 1 to `nup`, so the particle in the line N is stored at the
+// index N - 1 of a contiguous array. The map-style lookups by line number are
+// kept.
+class EventEntry {
+private:
+    Particles particles_;
+
+public:
+    using value_type = Particle;
+    using const_iterator = Particles::const_iterator;
+
+    EventEntry() {}
+
+    // Puts the particle at its line, adding empty lines in between if needed.
+    void insert(const std::pair<int, Particle> &entry);
+
+    const Particle &at(int line) const { return particles_.at(line - 1); }
+    Particle &at(int line) { return particles_.at(line - 1); }
+    std::size_t count(int line) const {
+        return line >= 1 && static_cast<std::size_t>(line) <= size() ? 1 : 0;
+    }
+    const_iterator find(int line) const {
+        return count(line) ? particles_.cbegin() + (line - 1) : cend();
+    }
+
+    const_iterator begin() const { return particles_.cbegin(); }
+    const_iterator end() const { return particles_.cend(); }
+    const_iterator cbegin() const { return particles_.cbegin(); }
+    const_iterator cend() const { return particles_.cend(); }
+
+    std::size_t size() const { return particles_.size(); }
+    bool empty() const { return particles_.empty(); }
+    // Keeps the allocated storage even if the number of lines gets smaller.
+    void resize(std::size_t nup) { particles_.resize(nup); }
+    void clear() { particles_.clear(); }
+
+    const Particles &particles() const { return particles_; }
+};
+
 std::string show(const EventEntry &entry);
 
 class Event {
@@ -105,9 +146,17 @@ public:
         event_ = std::make_pair(evinfo, entry);
     }
 
-    EventInfo eventInfo() const { return event_.first; }
-    EventEntry particleEntries() const { return event_.second; }
-    Particles particles() const;
+    // Prepares the event for `evinfo.nup` particle lines, reusing the
+    // storage allocated for the previous events. The particles are filled
+    // by `setParticle`.
+    void resetEvent(const EventInfo &evinfo);
+    void setParticle(int line, const Particle &p);
+
+    const EventInfo &eventInfo() const { return event_.first; }
+    const EventEntry &particleEntries() const { return event_.second; }
+    // The particles in the order of the lines. It is a view to the entries,
+    // not a copy.
+    const Particles &particles() const { return event_.second.particles(); }
 
     bool empty() const { return status_ == EventStatus::Empty; }
     bool done() const { return empty(); }
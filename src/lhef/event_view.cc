@@ -0,0 +1,99 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhef/event_view.h"
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include "colevent_charconv.h"
+#include "lhef/parser.h"
+
+namespace lhef {
+bool EventView::reset(const char *first, const char *last) {
+    first_ = first;
+    last_ = last;
+    lines_indexed_ = false;
+    num_parsed_ = 0;
+    evinfo_ = EventInfo();
+    if (first == last) {
+        empty_ = true;
+        return false;
+    }
+
+    colevent::TokenReader reader(first, last);
+    reader >> evinfo_.nup >> evinfo_.idprup >> evinfo_.xwgtup >>
+        evinfo_.scalup >> evinfo_.aqedup >> evinfo_.aqcdup;
+    body_ = colevent::nextLine(reader.position(), last);
+    empty_ = false;
+    return true;
+}
+
+void EventView::indexLines() const {
+    const auto nup = static_cast<std::size_t>(size());
+    lines_.assign(nup, nullptr);
+    std::size_t i = 0;
+    for (const char *line = body_; i < nup && line < last_;
+         line = colevent::nextLine(line, last_)) {
+        if (*line == '#') { continue; }  // comment line
+        const char *c = line;
+        while (c != last_ && colevent::isBlank(*c)) { ++c; }
+        if (c == last_ || *c == '\n') { continue; }  // blank line
+        lines_[i++] = line;
+    }
+
+    particles_.resize(nup);
+    parsed_.assign(nup, 0);
+    lines_indexed_ = true;
+}
+
+const Particle &EventView::at(int line) const {
+    if (line < 1 || line > size()) {
+        throw std::out_of_range("lhef::EventView::at");
+    }
+    if (!lines_indexed_) { indexLines(); }
+
+    const std::size_t i = line - 1;
+    if (!parsed_[i]) {
+        const char *first = lines_[i];
+        particles_[i] = first == nullptr
+                            ? Particle()
+                            : parseParticle(first,
+                                            colevent::nextLine(first, last_));
+        parsed_[i] = 1;
+        ++num_parsed_;
+    }
+    return particles_[i];
+}
+
+const Particles &EventView::particles() const {
+    if (!lines_indexed_) { indexLines(); }
+    for (int line = 1; num_parsed_ < size(); ++line) { at(line); }
+    return particles_;
+}
+
+void EventView::toEvent(Event *lhe) const {
+    if (empty_) {
+        (*lhe)(Event::EventStatus::Empty);
+        return;
+    }
+    lhe->resetEvent(evinfo_);
+    const Particles &ps = particles();
+    for (int line = 1; line <= size(); ++line) {
+        lhe->setParticle(line, ps[line - 1]);
+    }
+}
+
+bool parseEvent(const char *first, const char *last, EventView *view) {
+    return view->reset(first, last);
+}
+
+bool parseEvent(MappedReader *reader, EventView *view) {
+    const auto text = reader->nextEventText();
+    return view->reset(text.first, text.second);
+}
+
+bool parseEvent(std::istream *is, EventView *view) {
+    eventStr(is, &view->text_);
+    const std::string &text = view->text_;
+    return view->reset(text.data(), text.data() + text.size());
+}
+}  // namespace lhef
@@ -0,0 +1,84 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_LHEF_EVENT_VIEW_H_
+#define COLEVENT_SRC_LHEF_EVENT_VIEW_H_
+
+#include <istream>
+#include <string>
+#include <vector>
+#include "lhef/event.h"
+#include "lhef/mapped_reader.h"
+#include "lhef/particle.h"
+
+namespace lhef {
+// A view to the text of an event which only parses the `EventInfo` line
+// eagerly. A particle line is parsed when it is first accessed, and the
+// result is kept until the view is reset to another event. Analyses reading
+// the weights or a few particles of each event skip most of the parsing.
+//
+// The view points to the text it has been reset to, e.g., the memory-mapped
+// file of `lhef::MappedReader`, which must outlive the view. Each particle is
+// expected to be in a line of its own.
+class EventView {
+private:
+    const char *first_ = nullptr;
+    const char *last_ = nullptr;
+    // The text of the event read from a stream.
+    std::string text_;
+    EventInfo evinfo_;
+    bool empty_ = true;
+    // The beginning of the particle lines following the `EventInfo` line.
+    const char *body_ = nullptr;
+
+    // Filled on demand. A null line is missing in the text, and the particle
+    // there is zero as in `lhef::parseEvent`.
+    mutable std::vector<const char *> lines_;
+    mutable bool lines_indexed_ = false;
+    mutable Particles particles_;
+    mutable std::vector<char> parsed_;
+    mutable int num_parsed_ = 0;
+
+public:
+    EventView() {}
+
+    // The view refers to its own storage and the text, so it is neither
+    // copied nor moved. It is reused for the events in turn.
+    EventView(const EventView &) = delete;
+    EventView &operator=(const EventView &) = delete;
+
+    // Views the lines of an event, i.e., the text between the `<event>` and
+    // `</event>` tags. It returns false if the text is empty.
+    bool reset(const char *first, const char *last);
+
+    bool empty() const { return empty_; }
+    bool done() const { return empty(); }
+
+    const EventInfo &eventInfo() const { return evinfo_; }
+    // The number of particle lines, `nup`.
+    int size() const { return evinfo_.nup > 0 ? evinfo_.nup : 0; }
+
+    // The particle in the line numbered from 1 as in `EventEntry::at`. It
+    // throws `std::out_of_range` if there is no such line.
+    const Particle &at(int line) const;
+    // All the particles in the order of the lines, parsing the ones that have
+    // not been accessed yet.
+    const Particles &particles() const;
+
+    // Fills a fully parsed event.
+    void toEvent(Event *lhe) const;
+
+    friend bool parseEvent(std::istream *is, EventView *view);
+
+private:
+    void indexLines() const;
+};
+
+bool parseEvent(const char *first, const char *last, EventView *view);
+
+bool parseEvent(MappedReader *reader, EventView *view);
+
+// The text of the event is kept in the view.
+bool parseEvent(std::istream *is, EventView *view);
+}  // namespace lhef
+
+#endif  // COLEVENT_SRC_LHEF_EVENT_VIEW_H_
@@ -4,7 +4,6 @@
 #include <algorithm>
 #include <functional>
 #include <string>
-#include <utility>
 #include "particle.h"
 
 namespace lhef {
@@ -14,28 +13,21 @@ std::string closingLine() { return "</LesHouchesEvents>"; }
 
 Particles selectParticlesBy(
     std::function<bool(const Particles::value_type &)> pred, const Event &lhe) {
-    const Particles ps{lhe.particles()};
-    return selectBy(pred, ps);  // definition: see `particle.h`.
+    return selectBy(pred, lhe.particles());  // definition: see `particle.h`.
 }
 
 Particles initialStates(const Event &lhe) {
-    const Particles ps{lhe.particles()};
-    return initialStates(ps);
+    return initialStates(lhe.particles());
 }
 
 Particles intermediateStates(const Event &lhe) {
-    const Particles ps{lhe.particles()};
-    return intermediateStates(ps);
+    return intermediateStates(lhe.particles());
 }
 
-Particles finalStates(const Event &lhe) {
-    const Particles ps{lhe.particles()};
-    return finalStates(ps);
-}
+Particles finalStates(const Event &lhe) { return finalStates(lhe.particles()); }
 
 Particles collisionProducts(const Event &lhe) {
-    const Particles ps{lhe.particles()};
-    return collisionProducts(ps);
+    return collisionProducts(lhe.particles());
 }
 
 Particles particlesOf(const ParticleID &pid, const Event &lhe) {
@@ -45,27 +37,31 @@ Particles particlesOf(const ParticleID &pid, const Event &lhe) {
 
 ParticleLines particleLinesOf(const ParticleID &pid, const Event &lhe) {
     ParticleLines line;
-    const auto entry{lhe.particleEntries()};
-    for (const auto &e : entry) {
-        const auto particle{e.second};
-        if (particle.is(pid)) { line.push_back(std::move(e.first)); }
+    const auto &entry = lhe.particleEntries();
+    for (int l = 1; l <= static_cast<int>(entry.size()); ++l) {
+        if (entry.at(l).is(pid)) { line.push_back(l); }
     }
     return line;
 }
 
-Particle mother(const Particle &p, const Event &lhe) {
+const Particle &motherOf(const Particle &p, const EventEntry &entry) {
     const int mo_line = p.mother().first;
-    const auto entry{lhe.particleEntries()};
-    if (entry.find(mo_line) == entry.end()) {  // mother particle not found
+    if (!entry.count(mo_line)) {  // mother particle not found
         return entry.at(1);
     } else {
         return entry.at(mo_line);
     }
 }
 
+Particle mother(const Particle &p, const Event &lhe) {
+    return motherOf(p, lhe.particleEntries());
+}
+
 Particle ancestor(const Particle &p, const Event &lhe) {
-    const auto m = mother(p, lhe);
-    return m.mother().first == 1 ? m : ancestor(m, lhe);
+    const auto &entry = lhe.particleEntries();
+    const Particle *m = &motherOf(p, entry);
+    while (m->mother().first != 1) { m = &motherOf(*m, entry); }
+    return *m;
 }
 
 Particles daughters(int pline, const Event &lhe) {
@@ -75,23 +71,23 @@ Particles daughters(int pline, const Event &lhe) {
     return selectParticlesBy(pred, lhe);
 }
 
-bool isInMotherLines(const int pline, const Particle &p, const Event &lhe) {
-    const int mo_line = p.mother().first;
-    if (mo_line == 1) {
-        return false;
-    } else if (mo_line == pline) {
-        return true;
-    } else {
-        const auto direct_mother{mother(p, lhe)};
-        return isInMotherLines(pline, direct_mother, lhe);
+bool isInMotherLines(const int pline, const Particle &p,
+                     const EventEntry &entry) {
+    const Particle *q = &p;
+    for (int mo_line = q->mother().first; mo_line != 1;
+         mo_line = q->mother().first) {
+        if (mo_line == pline) { return true; }
+        q = &motherOf(*q, entry);
     }
+    return false;
 }
 
 Particles finalDaughters(int pline, const Event &lhe) {
     Particles finalstates = finalStates(lhe);
+    const auto &entry = lhe.particleEntries();
     auto pos = std::remove_if(finalstates.begin(), finalstates.end(),
-                              [pline, &lhe](const Particle &p) {
-                                  return !isInMotherLines(pline, p, lhe);
+                              [pline, &entry](const Particle &p) {
+                                  return !isInMotherLines(pline, p, entry);
                               });
     finalstates.erase(pos, finalstates.end());
     return finalstates;
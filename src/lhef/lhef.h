@@ -4,14 +4,13 @@
 #define COLEVENT_SRC_LHEF_LHEF_H_
 
 #include <string>
+#include "lhef/decay_tree.h"
 #include "lhef/event.h"
 #include "lhef/parser.h"
 #include "lhef/particle.h"
 #include "lhef/pid.h"
 
 namespace lhef {
-using ParticleLines = std::vector<int>;
-
 std::string openingLine();
 
 std::string closingLine();
@@ -0,0 +1,80 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhef/mapped_reader.h"
+#include <string_view>
+#include <utility>
+#include "colevent_charconv.h"
+#include "lhef/parser.h"
+
+namespace lhef {
+const char *findTag(const char *first, const char *last,
+                    std::string_view tag) {
+    const std::string_view text(first, last - first);
+    const auto pos = text.find(tag);
+    return pos == std::string_view::npos ? last : first + pos;
+}
+
+const char *findEventTag(const char *first, const char *last) {
+    return findTag(first, last, "<event");
+}
+
+std::pair<const char *, const char *> nextEventText(const char **pos,
+                                                    const char *last) {
+    if (*pos == nullptr || *pos == last) { return {last, last}; }
+
+    const char *tag = findEventTag(*pos, last);
+    if (tag == last) {  // no more events
+        *pos = last;
+        return {last, last};
+    }
+
+    const char *first = colevent::nextLine(tag, last);
+    const char *end_tag = findTag(first, last, "</event");
+    const char *end = end_tag;
+    if (end_tag != last) {  // the closing tag line is not a part of the event
+        while (end != first && *(end - 1) != '\n') { --end; }
+    }
+    *pos = colevent::nextLine(end_tag, last);
+    return {first, end};
+}
+
+std::size_t skipEvents(const char **pos, const char *last, std::size_t n) {
+    std::size_t num_skipped = 0;
+    for (; num_skipped != n && *pos != nullptr && *pos != last;
+         ++num_skipped) {
+        const char *tag = findEventTag(*pos, last);
+        if (tag == last) {  // no more events
+            *pos = last;
+            break;
+        }
+        *pos = colevent::nextLine(findTag(tag, last, "</event"), last);
+    }
+    return num_skipped;
+}
+
+bool MappedReader::selectEvents(const colevent::EventIndex &index,
+                                std::size_t i, std::size_t j) {
+    if (index.sourceSize() != file_.size() || i > j || j > index.size()) {
+        return false;
+    }
+    pos_ = i < index.size() ? file_.begin() + index.offset(i) : file_.end();
+    last_ = j < index.size() ? file_.begin() + index.offset(j) : file_.end();
+    return true;
+}
+
+std::pair<const char *, const char *> MappedReader::nextEventText() {
+    const auto text = lhef::nextEventText(&pos_, last_);
+    if (prescale_ > 1) { skip(prescale_ - 1); }
+    return text;
+}
+
+Event parseEvent(MappedReader *reader) {
+    const auto text = reader->nextEventText();
+    return parseEvent(text.first, text.second);
+}
+
+bool parseEvent(MappedReader *reader, Event *lhe) {
+    const auto text = reader->nextEventText();
+    return parseEvent(text.first, text.second, lhe);
+}
+}  // namespace lhef
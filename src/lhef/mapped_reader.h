@@ -0,0 +1,73 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_LHEF_MAPPED_READER_H_
+#define COLEVENT_SRC_LHEF_MAPPED_READER_H_
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include "colevent_event_index.h"
+#include "colevent_mapped_file.h"
+#include "lhef/event.h"
+
+namespace lhef {
+// The beginning of the first `<event` tag in [first, last), or `last` if
+// there is none.
+const char *findEventTag(const char *first, const char *last);
+
+// The lines of the first event in [*pos, last), excluding the lines of the
+// `<event>` and `</event>` tags. `*pos` is moved past the event. It returns
+// an empty range if there are no more events.
+std::pair<const char *, const char *> nextEventText(const char **pos,
+                                                    const char *last);
+
+// Moves `*pos` past the next `n` events in [*pos, last). Only the `<event`
+// and `</event` tags are searched for, so that nothing is tokenized. It
+// returns the number of events skipped, which is less than `n` if the text
+// ends before.
+std::size_t skipEvents(const char **pos, const char *last, std::size_t n);
+
+// Reads events from a memory-mapped LHEF file. The event lines are parsed in
+// place instead of being copied line by line into a stream.
+class MappedReader {
+private:
+    colevent::MappedFile file_;
+    const char *pos_ = nullptr;
+    const char *last_ = nullptr;
+    std::size_t prescale_ = 1;
+
+public:
+    explicit MappedReader(const std::string &fname)
+        : file_(fname), pos_(file_.begin()), last_(file_.end()) {}
+
+    explicit operator bool() const { return file_.is_open(); }
+
+    // Restricts the reader to the events [i, j) of the index, which must have
+    // been built from the same file. `seek(index, i)` reads from the `i`-th
+    // event to the end. They return false if the index does not fit the file.
+    bool selectEvents(const colevent::EventIndex &index, std::size_t i,
+                      std::size_t j);
+    bool seek(const colevent::EventIndex &index, std::size_t i) {
+        return selectEvents(index, i, index.size());
+    }
+
+    // Skips the next `n` events without parsing them. It returns the number
+    // of events skipped.
+    std::size_t skip(std::size_t n) {
+        return lhef::skipEvents(&pos_, last_, n);
+    }
+
+    // Reads only every `k`-th event from now on: the `k - 1` events after
+    // each event read are skipped. `prescale(1)` reads all the events.
+    void prescale(std::size_t k) { prescale_ = k == 0 ? 1 : k; }
+
+    // See `lhef::nextEventText` above.
+    std::pair<const char *, const char *> nextEventText();
+};
+
+Event parseEvent(MappedReader *reader);
+
+bool parseEvent(MappedReader *reader, Event *lhe);
+}  // namespace lhef
+
+#endif  // COLEVENT_SRC_LHEF_MAPPED_READER_H_
@@ -0,0 +1,106 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhef/parallel_reader.h"
+#include <deque>
+#include <functional>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+#include "colevent_mapped_file.h"
+#include "colevent_thread_pool.h"
+#include "lhef/mapped_reader.h"
+#include "lhef/parser.h"
+
+namespace lhef {
+using Chunk = std::pair<const char *, const char *>;
+
+std::vector<Chunk> splitIntoChunks(const char *first, const char *last,
+                                   std::size_t chunk_size) {
+    std::vector<Chunk> chunks;
+    if (chunk_size == 0) { chunk_size = 1; }
+    const char *begin = first;
+    while (begin != last) {
+        const char *end = last;
+        if (static_cast<std::size_t>(last - begin) > chunk_size) {
+            end = findEventTag(begin + chunk_size, last);
+        }
+        chunks.push_back({begin, end});
+        begin = end;
+    }
+    return chunks;
+}
+
+// An empty event, i.e., `<event>` followed by `</event>`, is skipped, so that
+// the events read do not depend on the chunk size.
+std::vector<Event> parseChunk(const Chunk &chunk) {
+    std::vector<Event> events;
+    const char *pos = chunk.first;
+    for (Event lhe; pos != chunk.second;) {
+        const auto text = nextEventText(&pos, chunk.second);
+        if (parseEvent(text.first, text.second, &lhe)) {
+            events.push_back(lhe);
+        }
+    }
+    return events;
+}
+
+long parseChunk(const Chunk &chunk,
+                const std::function<void(const Event &)> &func) {
+    long num_eve = 0;
+    const char *pos = chunk.first;
+    for (Event lhe; pos != chunk.second;) {
+        const auto text = nextEventText(&pos, chunk.second);
+        if (parseEvent(text.first, text.second, &lhe)) {
+            func(lhe);
+            ++num_eve;
+        }
+    }
+    return num_eve;
+}
+
+long parseEventsParallel(const char *first, const char *last,
+                         const std::function<void(const Event &)> &func,
+                         const ParallelOptions &opts) {
+    const auto chunks = splitIntoChunks(first, last, opts.chunk_size);
+    colevent::ThreadPool pool(opts.num_threads);
+    long num_eve = 0;
+
+    if (!opts.ordered) {
+        std::vector<std::future<long>> results;
+        results.reserve(chunks.size());
+        for (const auto &chunk : chunks) {
+            results.push_back(pool.submit(
+                [&chunk, &func] { return parseChunk(chunk, func); }));
+        }
+        for (auto &r : results) { num_eve += r.get(); }
+        return num_eve;
+    }
+
+    // Keep a few chunks per thread in flight. The parsed chunks are delivered
+    // in the order of submission, which bounds the memory in use.
+    const std::size_t max_in_flight = 2 * pool.size();
+    std::deque<std::future<std::vector<Event>>> results;
+    auto next_chunk = chunks.cbegin();
+    while (next_chunk != chunks.cend() || !results.empty()) {
+        while (next_chunk != chunks.cend() && results.size() < max_in_flight) {
+            const Chunk &chunk = *next_chunk++;
+            results.push_back(
+                pool.submit([&chunk] { return parseChunk(chunk); }));
+        }
+        const auto events = results.front().get();
+        results.pop_front();
+        for (const auto &lhe : events) { func(lhe); }
+        num_eve += events.size();
+    }
+    return num_eve;
+}
+
+long parseEventsParallel(const std::string &fname,
+                         const std::function<void(const Event &)> &func,
+                         const ParallelOptions &opts) {
+    const colevent::MappedFile file(fname);
+    if (!file.is_open()) { return -1; }
+    return parseEventsParallel(file.begin(), file.end(), func, opts);
+}
+}  // namespace lhef
@@ -0,0 +1,40 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_LHEF_PARALLEL_READER_H_
+#define COLEVENT_SRC_LHEF_PARALLEL_READER_H_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include "lhef/event.h"
+
+namespace lhef {
+struct ParallelOptions {
+    // Number of threads parsing the events. If it is 0, the number of
+    // hardware threads is used.
+    unsigned num_threads = 0;
+    // Approximate size in bytes of the chunks parsed by each task. The
+    // chunks are split at the `<event` tags.
+    std::size_t chunk_size = std::size_t(4) << 20;
+    // If true, the events are delivered in the order of the file, one at a
+    // time on the calling thread. Otherwise, the worker threads call the
+    // function concurrently as soon as the events are parsed, so it must be
+    // thread-safe.
+    bool ordered = true;
+};
+
+// Parses the events in [first, last) on a thread pool and calls `func` for
+// each of them. It returns the number of events. Unlike the sequential
+// readers, which stop there, it skips the empty events.
+long parseEventsParallel(const char *first, const char *last,
+                         const std::function<void(const Event &)> &func,
+                         const ParallelOptions &opts = ParallelOptions());
+
+// The same as above for a memory-mapped file. It returns -1 if the file
+// cannot be opened.
+long parseEventsParallel(const std::string &fname,
+                         const std::function<void(const Event &)> &func,
+                         const ParallelOptions &opts = ParallelOptions());
+}  // namespace lhef
+
+#endif  // COLEVENT_SRC_LHEF_PARALLEL_READER_H_
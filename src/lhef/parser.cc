@@ -3,58 +3,90 @@
 #include "lhef/parser.h"
 #include <istream>
 #include <memory>
-#include <sstream>
 #include <string>
 #include <utility>
+#include "colevent_charconv.h"
 
 using std::string;
 
 namespace lhef {
-void skipTillEventLine(std::istream *is) {
-    std::string line;
-    while (std::getline(*is, line) && line.find("<event") == string::npos) {
+void skipTillEventLine(std::istream *is, std::string *line) {
+    while (std::getline(*is, *line) && line->find("<event") == string::npos) {
         continue;
     }
 }
 
-std::string eventStr(std::istream *is) {
-    skipTillEventLine(is);
+void eventStr(std::istream *is, std::string *event_line) {
+    // The buffers are reused so that reading does not allocate once they
+    // have grown to the size of the longest line and event.
+    thread_local std::string line;
+    skipTillEventLine(is, &line);
 
-    std::string event_line(""), line;
+    event_line->clear();
     while (std::getline(*is, line)) {
         if (line.find("</event") == string::npos) {
             if (line.front() == '#') {  // comment line
                 continue;
             } else {
-                event_line += line + '\n';
+                event_line->append(line);
+                event_line->push_back('\n');
             }
         } else {  // end of the event lines reached
             break;
         }
     }
-    return event_line;
 }
 
 Event parseEvent(std::istream *is) {
-    string evstr = eventStr(is);
+    Event lhe;
+    parseEvent(is, &lhe);
+    return lhe;
+}
 
+bool parseEvent(std::istream *is, Event *lhe) {
+    thread_local std::string evstr;
+    eventStr(is, &evstr);
+    return parseEvent(evstr.data(), evstr.data() + evstr.size(), lhe);
+}
+
+Event parseEvent(const char *first, const char *last) {
     Event lhe;
-    if (!evstr.empty()) {
-        std::istringstream iss(evstr);
-        EventInfo evinfo;
-        iss >> evinfo;
+    parseEvent(first, last, &lhe);
+    return lhe;
+}
 
-        Particle p;
-        EventEntry entry;
-        for (int i = 0; i < evinfo.nup; ++i) {
-            iss >> p;
-            entry.insert({i + 1, p});
-        }
-        lhe.setEvent(evinfo, entry);
-    } else {
-        lhe(Event::EventStatus::Empty);
+bool parseEvent(const char *first, const char *last, Event *lhe) {
+    if (first == last) {
+        (*lhe)(Event::EventStatus::Empty);
+        return false;
     }
-    return lhe;
+
+    colevent::TokenReader reader(first, last);
+    EventInfo evinfo;
+    reader >> evinfo.nup >> evinfo.idprup >> evinfo.xwgtup >> evinfo.scalup >>
+        evinfo.aqedup >> evinfo.aqcdup;
+    lhe->resetEvent(evinfo);
+
+    int idup, istup, mothup1, mothup2, icolup1, icolup2;
+    double pup1, pup2, pup3, pup4, pup5, vtimup, spinup;
+    for (int i = 0; i < evinfo.nup; ++i) {
+        reader >> idup >> istup >> mothup1 >> mothup2 >> icolup1 >> icolup2 >>
+            pup1 >> pup2 >> pup3 >> pup4 >> pup5 >> vtimup >> spinup;
+        lhe->setParticle(i + 1, Particle(idup, istup, mothup1, mothup2,
+                                         icolup1, icolup2, pup1, pup2, pup3,
+                                         pup4, pup5, vtimup, spinup));
+    }
+    return true;
+}
+
+Particle parseParticle(const char *first, const char *last) {
+    colevent::TokenReader reader(first, last);
+    int idup, istup, mothup1, mothup2, icolup1, icolup2;
+    double pup1, pup2, pup3, pup4, pup5, vtimup, spinup;
+    reader >> idup >> istup >> mothup1 >> mothup2 >> icolup1 >> icolup2 >>
+        pup1 >> pup2 >> pup3 >> pup4 >> pup5 >> vtimup >> spinup;
+    return Particle(idup, istup, mothup1, mothup2, icolup1, icolup2, pup1,
+                    pup2, pup3, pup4, pup5, vtimup, spinup);
 }
 
 std::pair<bool, Event> parseOrFail(std::shared_ptr<std::istream> is) {
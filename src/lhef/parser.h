@@ -5,12 +5,36 @@
 
 #include <istream>
 #include <memory>
+#include <string>
 #include <utility>
 #include "lhef/event.h"
 
 namespace lhef {
 Event parseEvent(std::istream *is);
 
+// Reads the next event into `lhe`, reusing the storage of the previous event.
+// It returns false if there are no more events. After the first few events,
+// the loop
+//
+//     lhef::Event lhe;
+//     while (lhef::parseEvent(&fin, &lhe)) { ... }
+//
+// does not allocate memory.
+bool parseEvent(std::istream *is, Event *lhe);
+
+// Parses the lines of an event, i.e., the text between the `<event>` and
+// `</event>` tags, without copying them into a stream.
+Event parseEvent(const char *first, const char *last);
+
+bool parseEvent(const char *first, const char *last, Event *lhe);
+
+// Parses the 13 fields of a particle line in [first, last).
+Particle parseParticle(const char *first, const char *last);
+
+// Copies the lines of the next event in the stream into `event_line`,
+// excluding the lines of the `<event>` and `</event>` tags and comments.
+void eventStr(std::istream *is, std::string *event_line);
+
 std::pair<bool, Event> parseOrFail(std::shared_ptr<std::istream> is);
 }  // namespace lhef
 
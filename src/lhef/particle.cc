@@ -6,6 +6,7 @@
 #include <iostream>
 #include <iterator>
 #include <string>
+#include "colevent_batch_kinematics.h"
 #include "colevent_kinematics.h"
 #include "lester_mt2_bisect.h"
 #if DEBUG
@@ -112,6 +113,13 @@ string show(const Particles &ps) {
     return ps_str;
 }
 
+colevent::EtaPhiColumns etaPhi(const Particles &ps) {
+    colevent::MomentumColumns momenta;
+    momenta.reserve(ps.size());
+    for (const auto &p : ps) { momenta.add(momentum(p)); }
+    return colevent::etaPhiOf(momenta);
+}
+
 Particles selectByID(const ParticleID &pid, const Particles &ps) {
     auto pred = [&pid](const Particles::value_type &p) { return p.is(pid); };
     return selectBy(pred, ps);
@@ -13,6 +13,7 @@
 #include <string>
 #include <utility>
 #include <vector>
+#include "colevent_batch_kinematics.h"
 #include "colevent_kinematics.h"
 #include "lhef/pid.h"
 
@@ -61,6 +62,7 @@ public:
     int status() const { return istup_; }
     void set_status(int s) { istup_ = s; }
     std::pair<int, int> mother() const { return mothup_; }
+    std::pair<int, int> color() const { return icolup_; }
     double px() const { return pup_[0]; }
     double py() const { return pup_[1]; }
     double pz() const { return pup_[2]; }
@@ -115,6 +117,10 @@ using Particles = std::vector<Particle>;
 
 std::string show(const Particles &ps);
 
+// The pseudorapidities and the azimuthal angles of `ps`, computed in a
+// batch, for `colevent::deltaRMatrix` and `colevent::minDeltaR`.
+colevent::EtaPhiColumns etaPhi(const Particles &ps);
+
 inline void transformParticles(
     const Particles &ps,
     std::function<void(const Particles::value_type &)> func) {
@@ -0,0 +1,88 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include "lhef/writer.h"
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include "colevent_charconv.h"
+
+using colevent::appendFixed;
+using colevent::appendInt;
+using colevent::appendScientific;
+
+namespace lhef {
+void render(const Particle &p, std::string *out) {
+    appendInt(out, p.pid(), 9);
+    appendInt(out, p.status(), 5);
+    appendInt(out, p.mother().first, 5);
+    appendInt(out, p.mother().second, 5);
+    appendInt(out, p.color().first, 5);
+    appendInt(out, p.color().second, 5);
+    for (double momentum : {p.px(), p.py(), p.pz(), p.energy(), p.mass()}) {
+        appendScientific(out, momentum, 11, 19);
+    }
+    appendFixed(out, p.decayLength(), 0, 2);
+    out->push_back('.');
+    appendFixed(out, p.spin(), 0, 3);
+    out->push_back('.');
+}
+
+void render(const EventInfo &evinfo, std::string *out) {
+    appendInt(out, evinfo.nup, 6);
+    appendInt(out, evinfo.idprup, 6);
+    appendScientific(out, evinfo.xwgtup, 7, 15);
+    appendScientific(out, evinfo.scalup, 7, 15);
+    appendScientific(out, evinfo.aqedup, 7, 15);
+    appendScientific(out, evinfo.aqcdup, 7, 15);
+}
+
+void render(const GlobalInfo &info, std::string *out) {
+    out->append("<init>\n");
+    appendInt(out, info.idbmup.first, 9);
+    appendInt(out, info.idbmup.second, 9);
+    appendScientific(out, info.ebmup.first, 11, 19);
+    appendScientific(out, info.ebmup.second, 11, 19);
+    appendInt(out, info.pdfgup.first, 2);
+    appendInt(out, info.pdfgup.second, 2);
+    appendInt(out, info.pdfsup.first, 6);
+    appendInt(out, info.pdfsup.second, 6);
+    appendInt(out, info.idwtup, 2);
+    appendInt(out, info.nprup, 3);
+    out->push_back('\n');
+
+    const auto nproc = std::min({info.xsecup.size(), info.xerrup.size(),
+                                 info.xmaxup.size(), info.lprup.size()});
+    for (std::size_t i = 0; i < nproc; ++i) {
+        appendScientific(out, info.xsecup[i], 11, 19);
+        appendScientific(out, info.xerrup[i], 11, 19);
+        appendScientific(out, info.xmaxup[i], 11, 19);
+        appendInt(out, info.lprup[i], 4);
+        out->push_back('\n');
+    }
+    out->append("</init>");
+}
+
+void render(const Event &ev, std::string *out) {
+    out->append("<event>\n");
+    render(ev.eventInfo(), out);
+    out->push_back('\n');
+    for (const auto &p : ev.particles()) {
+        render(p, out);
+        out->push_back('\n');
+    }
+    out->append("</event>");
+}
+
+Writer::Writer(std::ostream *os, std::size_t flush_size)
+    : os_(os), flush_size_(flush_size) {
+    // Room for one more event past the flush size.
+    buf_.reserve(flush_size_ + (1 << 16));
+}
+
+void Writer::flush() {
+    if (!buf_.empty()) {
+        os_->write(buf_.data(), static_cast<std::streamsize>(buf_.size()));
+        buf_.clear();
+    }
+}
+}  // namespace lhef
@@ -0,0 +1,81 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_LHEF_WRITER_H_
+#define COLEVENT_SRC_LHEF_WRITER_H_
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include "colevent_charconv.h"
+#include "lhef/event.h"
+#include "lhef/particle.h"
+
+namespace lhef {
+// Append the same text as `operator<<` to `out`.
+void render(const Particle &p, std::string *out);
+
+void render(const EventInfo &evinfo, std::string *out);
+
+void render(const GlobalInfo &info, std::string *out);
+
+void render(const Event &ev, std::string *out);
+
+// Writes LHEF text to a stream through a buffer, which is flushed to the
+// stream in blocks of `flush_size` bytes and when the writer is destroyed.
+// The output is byte-for-byte identical to that of `operator<<`:
+//
+//     lhef::Writer writer(&fout);
+//     writer << lhef::openingLine() << '\n' << info << '\n';
+//     for (...) { writer << event << '\n'; }
+//     writer << lhef::closingLine() << '\n';
+class Writer {
+private:
+    std::ostream *os_;
+    std::string buf_;
+    std::size_t flush_size_;
+
+public:
+    explicit Writer(std::ostream *os, std::size_t flush_size = 1 << 20);
+    ~Writer() { flush(); }
+
+    Writer(const Writer &) = delete;
+    Writer &operator=(const Writer &) = delete;
+
+    // Writes the buffer to the stream.
+    void flush();
+
+    Writer &operator<<(const Event &ev) { return append(ev); }
+    Writer &operator<<(const EventInfo &evinfo) { return append(evinfo); }
+    Writer &operator<<(const GlobalInfo &info) { return append(info); }
+    Writer &operator<<(const Particle &p) { return append(p); }
+    Writer &operator<<(std::string_view text) {
+        buf_.append(text);
+        return checkFlush();
+    }
+    Writer &operator<<(char c) {
+        buf_.push_back(c);
+        return checkFlush();
+    }
+    // Written in decimal as by `std::ostream`, not converted to `char`. The
+    // other arithmetic types are ambiguous and do not compile.
+    Writer &operator<<(int n) {
+        colevent::appendInt(&buf_, n, 0);
+        return checkFlush();
+    }
+
+private:
+    template <typename T>
+    Writer &append(const T &x) {
+        render(x, &buf_);
+        return checkFlush();
+    }
+
+    Writer &checkFlush() {
+        if (buf_.size() >= flush_size_) { flush(); }
+        return *this;
+    }
+};
+}  // namespace lhef
+
+#endif  // COLEVENT_SRC_LHEF_WRITER_H_
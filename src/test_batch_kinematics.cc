@@ -0,0 +1,179 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "colevent_batch_kinematics.h"
+#include "colevent_kinematics.h"
+#include "colevent_simd.h"
+
+// The number of doubles between `a` and `b`. Infinities and NaNs must be
+// equal.
+std::uint64_t ulpDistance(double a, double b) {
+    if (std::isnan(a) || std::isnan(b)) {
+        return std::isnan(a) && std::isnan(b) ? 0 : UINT64_MAX;
+    }
+    if (std::isinf(a) || std::isinf(b)) { return a == b ? 0 : UINT64_MAX; }
+    auto ordered = [](double x) {
+        std::int64_t i;
+        std::memcpy(&i, &x, sizeof i);
+        return i < 0 ? INT64_MIN - i : i;
+    };
+    const std::int64_t ia = ordered(a), ib = ordered(b);
+    return ia > ib ? std::uint64_t(ia) - std::uint64_t(ib)
+                   : std::uint64_t(ib) - std::uint64_t(ia);
+}
+
+// Random momenta over many orders of magnitude, including massless and
+// off-shell ones, and the special cases of the scalar functions.
+colevent::MomentumColumns randomMomenta(std::size_t n) {
+    std::mt19937_64 rng(2026);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    std::uniform_real_distribution<double> exponent(-6.0, 4.0);
+    colevent::MomentumColumns momenta;
+    auto momentum = [&]() { return unit(rng) * std::pow(10.0, exponent(rng)); };
+    for (std::size_t i = 0; i < n; ++i) {
+        const double px = momentum(), py = momentum(), pz = momentum();
+        const double p = std::sqrt(px * px + py * py + pz * pz);
+        double e = p;
+        switch (i % 3) {
+        case 0:
+            e = std::hypot(p, std::abs(momentum()));
+            break;
+        case 1:
+            e = p * (1.0 - std::abs(unit(rng)) * 1e-3);  // spacelike
+            break;
+        }
+        momenta.add({colevent::Energy(e), colevent::Px(px), colevent::Py(py),
+                     colevent::Pz(pz)});
+    }
+    for (double pz : {0.0, 5.0, -5.0}) {
+        momenta.add({colevent::Energy(std::abs(pz)), colevent::Px(0.0),
+                     colevent::Py(0.0), colevent::Pz(pz)});
+    }
+    momenta.add({colevent::Energy(1.0), colevent::Px(-3.0), colevent::Py(-0.0),
+                 colevent::Pz(1e-320)});
+    return momenta;
+}
+
+// The matrices of the levels against `colevent::deltaPhi` and `deltaR` of
+// momenta with the same eta and phi.
+bool checkDeltaMatrices(const colevent::MomentumColumns &momenta) {
+    // Collections of the sizes of jets and leptons in an event, and larger.
+    const std::size_t n_rows = 13, n_cols = 37;
+    std::vector<colevent::FourMomentum> rows, cols;
+    colevent::EtaPhiColumns row_columns, col_columns;
+    for (std::size_t i = 0; i < n_rows + n_cols; ++i) {
+        const colevent::FourMomentum p{
+            colevent::Energy(momenta.energy[i]), colevent::Px(momenta.px[i]),
+            colevent::Py(momenta.py[i]), colevent::Pz(momenta.pz[i])};
+        (i < n_rows ? rows : cols).push_back(p);
+        (i < n_rows ? row_columns : col_columns).add(p.eta(), p.phi());
+    }
+
+    for (auto level : {colevent::SimdLevel::Scalar, colevent::SimdLevel::AVX2,
+                       colevent::SimdLevel::AVX512}) {
+        if (level > colevent::supportedSimdLevel()) { continue; }
+        colevent::setSimdLevel(level);
+        std::vector<double> dphi, dr, min_dr;
+        std::vector<int> closest;
+        colevent::deltaPhiMatrix(row_columns, col_columns, &dphi);
+        colevent::deltaRMatrix(row_columns, col_columns, &dr);
+        colevent::minDeltaR(row_columns, col_columns, &min_dr, &closest);
+        for (std::size_t i = 0; i < n_rows; ++i) {
+            int expected_closest = -1;
+            for (std::size_t j = 0; j < n_cols; ++j) {
+                const std::size_t ij = i * n_cols + j;
+                if (dphi[ij] != colevent::deltaPhi(rows[i], cols[j]) ||
+                    ulpDistance(dr[ij], colevent::deltaR(rows[i], cols[j])) >
+                        1) {
+                    std::cerr << "-- The " << colevent::show(level)
+                              << " matrices differ at (" << i << ", " << j
+                              << ").\n";
+                    return false;
+                }
+                if (expected_closest < 0 ||
+                    dr[ij] < dr[i * n_cols + expected_closest]) {
+                    expected_closest = static_cast<int>(j);
+                }
+            }
+            if (closest[i] != expected_closest ||
+                min_dr[i] != dr[i * n_cols + expected_closest]) {
+                std::cerr << "-- The " << colevent::show(level)
+                          << " minimum deltaR of row " << i << " differs.\n";
+                return false;
+            }
+        }
+        colevent::minDeltaR(row_columns, colevent::EtaPhiColumns(), &min_dr,
+                            &closest);
+        if (!std::isinf(min_dr.front()) || closest.front() != -1) {
+            std::cerr << "-- The minimum deltaR to nothing is not infinity.\n";
+            return false;
+        }
+    }
+    std::cout << "-- The deltaPhi and deltaR matrices agree.\n";
+    return true;
+}
+
+int main() {
+    // Not a multiple of the vector sizes, so that the last block is partial.
+    const auto momenta = randomMomenta(100003);
+
+    colevent::setSimdLevel(colevent::SimdLevel::Scalar);
+    colevent::KinematicsColumns expected;
+    colevent::computeKinematics(momenta, &expected);
+    for (std::size_t i = 0; i < momenta.size(); ++i) {
+        const colevent::FourMomentum p{
+            colevent::Energy(momenta.energy[i]), colevent::Px(momenta.px[i]),
+            colevent::Py(momenta.py[i]), colevent::Pz(momenta.pz[i])};
+        if (ulpDistance(expected.pt[i], p.pt()) != 0 ||
+            ulpDistance(expected.eta[i], p.eta()) != 0 ||
+            ulpDistance(expected.phi[i], p.phi()) != 0 ||
+            ulpDistance(expected.mass[i], p.mass()) != 0 ||
+            ulpDistance(expected.rapidity[i], p.rapidity()) != 0) {
+            std::cerr << "-- The scalar kernel differs at " << i << ".\n";
+            return 1;
+        }
+    }
+
+    // The bounds documented in `colevent_batch_kinematics.h`.
+    const std::uint64_t pt_ulp = 1, eta_ulp = 2, phi_ulp = 2, mass_ulp = 0,
+                        rapidity_ulp = 2;
+    for (auto level :
+         {colevent::SimdLevel::AVX2, colevent::SimdLevel::AVX512}) {
+        if (level > colevent::supportedSimdLevel()) { continue; }
+        colevent::setSimdLevel(level);
+        colevent::KinematicsColumns kin;
+        colevent::computeKinematics(momenta, &kin);
+
+        std::uint64_t max_ulp[5] = {0, 0, 0, 0, 0};
+        for (std::size_t i = 0; i < momenta.size(); ++i) {
+            const std::uint64_t ulp[5] = {
+                ulpDistance(kin.pt[i], expected.pt[i]),
+                ulpDistance(kin.eta[i], expected.eta[i]),
+                ulpDistance(kin.phi[i], expected.phi[i]),
+                ulpDistance(kin.mass[i], expected.mass[i]),
+                ulpDistance(kin.rapidity[i], expected.rapidity[i])};
+            for (int j = 0; j < 5; ++j) {
+                if (ulp[j] > max_ulp[j]) { max_ulp[j] = ulp[j]; }
+            }
+        }
+        std::cout << "-- " << colevent::show(level) << ": max ulp of pt "
+                  << max_ulp[0] << ", eta " << max_ulp[1] << ", phi "
+                  << max_ulp[2] << ", mass " << max_ulp[3] << ", rapidity "
+                  << max_ulp[4] << '\n';
+        if (max_ulp[0] > pt_ulp || max_ulp[1] > eta_ulp ||
+            max_ulp[2] > phi_ulp || max_ulp[3] > mass_ulp ||
+            max_ulp[4] > rapidity_ulp || kin.energy != momenta.energy) {
+            std::cerr << "-- The " << colevent::show(level)
+                      << " kernel exceeds the bounds.\n";
+            return 1;
+        }
+    }
+
+    if (!checkDeltaMatrices(momenta)) { return 1; }
+}
@@ -0,0 +1,224 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "lhco/lhco.h"
+
+using colevent::Eta;
+using colevent::Pt;
+
+const Pt kPtCut(30.0);
+const Eta kEtaCut(2.5);
+
+const std::vector<std::string> kCountNames = {
+    "numPhoton", "numPhoton(cut)", "numElectron", "numElectron(cut)",
+    "numMuon", "numMuon(cut)", "numLeptonIso", "numTau", "numTau(cut)",
+    "numNormalJet", "numNormalJet(cut)", "numBjet", "numBjet(cut)",
+    "numAllJet", "numAllJet(cut)", "missingET"};
+
+template <typename T>
+std::vector<double> column(const std::vector<T> &values) {
+    return std::vector<double>(values.cbegin(), values.cend());
+}
+
+// The batch counting functions, in the order of `kCountNames`.
+std::vector<std::vector<double>> counts(const lhco::EventBatch &batch) {
+    return {column(lhco::numPhoton(batch)),
+            column(lhco::numPhoton(kPtCut, kEtaCut, batch)),
+            column(lhco::numElectron(batch)),
+            column(lhco::numElectron(kPtCut, kEtaCut, batch)),
+            column(lhco::numMuon(batch)),
+            column(lhco::numMuon(kPtCut, kEtaCut, batch)),
+            column(lhco::numLeptonIso(batch)),
+            column(lhco::numTau(batch)),
+            column(lhco::numTau(kPtCut, kEtaCut, batch)),
+            column(lhco::numNormalJet(batch)),
+            column(lhco::numNormalJet(kPtCut, kEtaCut, batch)),
+            column(lhco::numBjet(batch)),
+            column(lhco::numBjet(kPtCut, kEtaCut, batch)),
+            column(lhco::numAllJet(batch)),
+            column(lhco::numAllJet(kPtCut, kEtaCut, batch)),
+            lhco::missingET(batch)};
+}
+
+// The per-event counting functions, in the order of `kCountNames`.
+std::vector<double> counts(const lhco::Event &ev) {
+    return {static_cast<double>(lhco::numPhoton(ev)),
+            static_cast<double>(lhco::numPhoton(kPtCut, kEtaCut, ev)),
+            static_cast<double>(lhco::numElectron(ev)),
+            static_cast<double>(lhco::numElectron(kPtCut, kEtaCut, ev)),
+            static_cast<double>(lhco::numMuon(ev)),
+            static_cast<double>(lhco::numMuon(kPtCut, kEtaCut, ev)),
+            static_cast<double>(lhco::numLeptonIso(ev)),
+            static_cast<double>(lhco::numTau(ev)),
+            static_cast<double>(lhco::numTau(kPtCut, kEtaCut, ev)),
+            static_cast<double>(lhco::numNormalJet(ev)),
+            static_cast<double>(lhco::numNormalJet(kPtCut, kEtaCut, ev)),
+            static_cast<double>(lhco::numBjet(ev)),
+            static_cast<double>(lhco::numBjet(kPtCut, kEtaCut, ev)),
+            static_cast<double>(lhco::numAllJet(ev)),
+            static_cast<double>(lhco::numAllJet(kPtCut, kEtaCut, ev)),
+            lhco::missingET(ev)};
+}
+
+// The columns of the type-specific members.
+bool sameMembers(const lhco::ObjectColumns &, std::size_t,
+                 const lhco::Visible &) {
+    return true;
+}
+
+int sign(int x) { return (x > 0) - (x < 0); }
+
+bool sameMembers(const lhco::ObjectColumns &c, std::size_t k,
+                 const lhco::Electron &p) {
+    return sign(c.ntrk[k]) == p.charge();
+}
+
+bool sameMembers(const lhco::ObjectColumns &c, std::size_t k,
+                 const lhco::Muon &p) {
+    return sign(c.ntrk[k]) == p.charge();
+}
+
+bool sameMembers(const lhco::ObjectColumns &c, std::size_t k,
+                 const lhco::Jet &p) {
+    return c.ntrk[k] == p.num_track();
+}
+
+// The objects of the event `i` of the batch against those of `lhco::Event`,
+// in the same order.
+template <typename T>
+bool sameObjects(const lhco::ObjectColumns &c, std::size_t i,
+                 const std::vector<T> &ps) {
+    if (c.size(i) != ps.size()) { return false; }
+    for (std::size_t j = 0; j < ps.size(); ++j) {
+        const std::size_t k = c.offsets[i] + j;
+        const auto &p = ps[j];
+        if (c.pt[k] != p.pt() || c.eta[k] != p.eta() || c.phi[k] != p.phi() ||
+            c.mass[k] != p.mass() || !sameMembers(c, k, p)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool sameOffsets(const lhco::ObjectColumns &c, std::size_t num_eve) {
+    return c.offsets.size() == num_eve + 1 && c.offsets.front() == 0 &&
+           c.offsets.back() == c.size() && c.eta.size() == c.size() &&
+           c.phi.size() == c.size() && c.mass.size() == c.size() &&
+           c.hadem.size() == c.size() && c.ntrk.size() == c.size() &&
+           c.btag.size() == c.size();
+}
+
+// The batch holding the events from `first` against `events`.
+bool sameBatch(const lhco::EventBatch &batch,
+               const std::vector<lhco::Event> &events, std::size_t first) {
+    const std::size_t n = batch.size();
+    if (first + n > events.size() || batch.met_phi().size() != n ||
+        batch.event_number().size() != n) {
+        std::cerr << "-- The batch from event " << first << " has "
+                  << n << " events.\n";
+        return false;
+    }
+    for (const auto *c : {&batch.photons(), &batch.electrons(),
+                          &batch.muons(), &batch.taus(), &batch.jets(),
+                          &batch.bjets()}) {
+        if (!sameOffsets(*c, n)) {
+            std::cerr << "-- The offsets of the batch from event " << first
+                      << " are wrong.\n";
+            return false;
+        }
+    }
+
+    const auto batch_counts = counts(batch);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto &ev = events[first + i];
+        if (batch.event_number()[i] != ev.header().event_number ||
+            batch.met_phi()[i] != ev.met().phi() ||
+            !sameObjects(batch.photons(), i, ev.photons()) ||
+            !sameObjects(batch.electrons(), i, ev.electrons()) ||
+            !sameObjects(batch.muons(), i, ev.muons()) ||
+            !sameObjects(batch.taus(), i, ev.taus()) ||
+            !sameObjects(batch.jets(), i, ev.jets()) ||
+            !sameObjects(batch.bjets(), i, ev.bjets())) {
+            std::cerr << "-- The columns of event " << first + i
+                      << " differ.\n";
+            return false;
+        }
+        const auto expected = counts(ev);
+        for (std::size_t f = 0; f < expected.size(); ++f) {
+            if (batch_counts[f].size() != n ||
+                batch_counts[f][i] != expected[f]) {
+                std::cerr << "-- " << kCountNames[f] << " of event "
+                          << first + i << " differs.\n";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cout << "Usage: test_batch_lhco input\n"
+                  << "    - input: Input file in "
+                  << "LHC Olympics format\n";
+        return 1;
+    }
+
+    std::ifstream filename(argv[1]);
+    if (!filename) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    std::ostringstream buffer;
+    buffer << filename.rdbuf();
+    const std::string text = buffer.str();
+
+    std::vector<lhco::Event> events;
+    std::istringstream is(text);
+    for (auto ev = lhco::parseEvent(&is); !ev.done();
+         ev = lhco::parseEvent(&is)) {
+        events.push_back(ev);
+    }
+    if (events.empty()) {
+        std::cerr << "-- No events in \"" << argv[1] << "\".\n";
+        return 1;
+    }
+
+    // The batches end in the middle of the file, except for the largest.
+    lhco::EventBatch batch;
+    for (std::size_t max_events : {1, 7, 250, 1 << 20}) {
+        std::istringstream batch_is(text);
+        std::size_t first = 0, n = 0;
+        while ((n = lhco::parseEventBatch(&batch_is, max_events, &batch)) > 0) {
+            if (n > max_events || !sameBatch(batch, events, first)) {
+                return 1;
+            }
+            first += n;
+        }
+
+        const char *pos = text.data(), *last = text.data() + text.size();
+        std::size_t first_mapped = 0;
+        while ((n = lhco::parseEventBatch(&pos, last, max_events, &batch)) >
+               0) {
+            if (n > max_events || !sameBatch(batch, events, first_mapped)) {
+                return 1;
+            }
+            first_mapped += n;
+        }
+
+        if (first != events.size() || first_mapped != events.size()) {
+            std::cerr << "-- " << first << " and " << first_mapped
+                      << " events read in batches of " << max_events
+                      << ".\n";
+            return 1;
+        }
+    }
+
+    std::cout << "-- The batches of " << events.size()
+              << " events agree with lhco::Event.\n";
+}
@@ -0,0 +1,134 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "lhco/cache.h"
+#include "lhco/lhco.h"
+#include "lhco/writer.h"
+#include "lhef/cache.h"
+#include "lhef/lhef.h"
+#include "lhef/mapped_reader.h"
+#include "lhef/writer.h"
+
+bool isLHCO(const std::string &fname) {
+    return fname.find(".lhco") != std::string::npos;
+}
+
+// A new empty file in the temporary directory, so that nothing is written next
+// to the input. It returns an empty string if the file cannot be created.
+std::string temporaryFile() {
+    const char *dir = std::getenv("TMPDIR");
+    std::string fname =
+        std::string(dir && *dir ? dir : "/tmp") + "/test_cache.XXXXXX";
+    const int fd = ::mkstemp(&fname[0]);
+    if (fd < 0) { return std::string(); }
+    ::close(fd);
+    return fname;
+}
+
+// The text of the input as the parsers read it: the lines before the first
+// event followed by the events rendered by `operator<<`.
+std::string renderedText(const std::string &fname) {
+    const colevent::MappedFile file(fname);
+    std::ostringstream os;
+    if (isLHCO(fname)) {
+        const char *first = lhco::findHeaderLine(file.begin(), file.end());
+        os.write(file.begin(), first - file.begin());
+        lhco::RawEvent ev;
+        for (const char *pos = first;
+             (pos = lhco::parseRawEvent(pos, file.end(), &ev)), !ev.empty();) {
+            os << ev << '\n';
+        }
+    } else {
+        const char *first = lhef::findEventTag(file.begin(), file.end());
+        os.write(file.begin(), first - file.begin());
+        lhef::MappedReader reader(fname);
+        for (lhef::Event lhe; lhef::parseEvent(&reader, &lhe);) {
+            os << lhe << '\n';
+        }
+        os << lhef::closingLine() << '\n';
+    }
+    return os.str();
+}
+
+// Compares the events read from the cache with those from the text.
+bool sameEvents(const std::string &fname, const std::string &cache_fname) {
+    if (isLHCO(fname)) {
+        std::ifstream fin(fname);
+        lhco::CacheReader reader(cache_fname), batch_reader(cache_fname);
+        lhco::Event ev;
+        lhco::EventBatch batch, expected_batch;
+        while (batch_reader.next_batch(100, &batch) > 0) {
+            lhco::parseEventBatch(&fin, 100, &expected_batch);
+            if (batch.event_number() != expected_batch.event_number() ||
+                batch.jets().pt != expected_batch.jets().pt ||
+                batch.muons().offsets != expected_batch.muons().offsets) {
+                return false;
+            }
+        }
+        fin.clear();
+        fin.seekg(0);
+        for (auto expected = lhco::parseEvent(&fin); !expected.done();
+             expected = lhco::parseEvent(&fin)) {
+            if (!reader.next(&ev) || show(ev) != show(expected)) {
+                return false;
+            }
+        }
+        return !reader.next(&ev);
+    }
+
+    lhef::MappedReader text_reader(fname);
+    lhef::CacheReader reader(cache_fname);
+    lhef::Event lhe, expected;
+    while (lhef::parseEvent(&text_reader, &expected)) {
+        if (!reader.next(&lhe) || show(lhe) != show(expected)) { return false; }
+    }
+    return !reader.next(&lhe);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cout << "Usage: test_cache input\n"
+                  << "    - input: Input file in LHEF or "
+                  << "LHC Olympics format\n";
+        return 1;
+    }
+
+    const std::string fname(argv[1]);
+    const std::string cache_fname = temporaryFile();
+    if (cache_fname.empty()) {
+        std::cerr << "-- Cannot create a temporary file.\n";
+        return 1;
+    }
+    // Small row groups, so that the events are in many of them.
+    const bool converted =
+        isLHCO(fname) ? lhco::convertToCache(fname, cache_fname, 100)
+                      : lhef::convertToCache(fname, cache_fname, 100);
+    if (!converted) {
+        std::cerr << "-- Cannot convert input file \"" << fname << "\".\n";
+        std::remove(cache_fname.c_str());
+        return 1;
+    }
+
+    std::ostringstream text;
+    const bool ok = isLHCO(fname) ? lhco::convertToText(cache_fname, &text)
+                                  : lhef::convertToText(cache_fname, &text);
+    int status = 0;
+    if (!ok || text.str() != renderedText(fname)) {
+        std::cerr << "-- The text from the cache differs.\n";
+        status = 1;
+    } else if (!sameEvents(fname, cache_fname)) {
+        std::cerr << "-- The events from the cache differ.\n";
+        status = 1;
+    } else {
+        std::cout << "-- The events of \"" << fname
+                  << "\" are the same through the cache.\n";
+    }
+    std::remove(cache_fname.c_str());
+    return status;
+}
@@ -0,0 +1,128 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "lhef/decay_tree.h"
+#include "lhef/lhef.h"
+
+// An event of the particles with (IDUP, ISTUP, MOTHUP(1), MOTHUP(2)).
+lhef::Event makeEvent(const std::vector<std::array<int, 4>> &lines) {
+    lhef::EventInfo evinfo;
+    evinfo.nup = static_cast<int>(lines.size());
+    lhef::Event lhe;
+    lhe.resetEvent(evinfo);
+    for (std::size_t i = 0; i < lines.size(); ++i) {
+        const auto &l = lines[i];
+        lhe.setParticle(static_cast<int>(i) + 1,
+                        lhef::Particle(l[0], l[1], l[2], l[3], 0, 0, 0.0, 0.0,
+                                       0.0, 0.0, 0.0, 0.0, 0.0));
+    }
+    lhe(lhef::Event::EventStatus::Fill);
+    return lhe;
+}
+
+bool check(bool ok, const std::string &what) {
+    if (!ok) { std::cerr << "-- " << what << " differs.\n"; }
+    return ok;
+}
+
+bool sameLines(const lhef::DecayTree::Lines &lines,
+               const std::vector<int> &expected) {
+    return std::vector<int>(lines.begin(), lines.end()) == expected;
+}
+
+// gg -> t tbar -> (b W+) (bbar W-) -> (b e+ nu_e) (bbar mu- nu_mu~). The
+// decay products have single mothers, where the tree overloads must agree
+// with the functions of `lhef.h`.
+bool checkTTbar(const lhef::DecayTree &tree, const lhef::Event &lhe) {
+    bool ok = true;
+    for (int l = 3; l <= 12; ++l) {
+        const std::string line = " of line " + std::to_string(l);
+        ok = ok && check(lhef::show(lhef::daughters(l, lhe)) ==
+                             lhef::show(lhef::daughters(l, lhe, tree)),
+                         "daughters" + line);
+        ok = ok && check(lhef::show(lhef::finalDaughters(l, lhe)) ==
+                             lhef::show(lhef::finalDaughters(l, lhe, tree)),
+                         "finalDaughters" + line);
+        // `lhef::ancestor` of the top quarks, made from the beams, never
+        // returns.
+        if (l == 3 || l == 5) { continue; }
+        const auto &p = lhe.particleEntries().at(l);
+        ok = ok && check(lhef::show(lhef::ancestor(p, lhe)) ==
+                             lhef::show(lhef::ancestor(l, lhe, tree)),
+                         "ancestor" + line);
+    }
+
+    // The documented differences at the beams and the top quarks.
+    ok = ok && check(sameLines(tree.daughterLines(2), {3, 5}) &&
+                         lhef::daughters(2, lhe).empty(),
+                     "daughters of the second mother");
+    ok = ok && check(tree.finalDaughterLines(1) ==
+                             lhef::ParticleLines{7, 8, 9, 10, 11, 12} &&
+                         lhef::finalDaughters(1, lhe).empty(),
+                     "finalDaughters of a beam");
+    ok = ok && check(tree.ancestorLine(1) == 0 && tree.ancestorLine(3) == 0 &&
+                         tree.ancestorLine(11) == 3,
+                     "ancestorLine");
+    ok = ok && check(tree.isDescendant(8, 5) && !tree.isDescendant(8, 3) &&
+                         tree.isDescendant(8, 2) && !tree.isDescendant(5, 8),
+                     "isDescendant");
+    return ok;
+}
+
+int main() {
+    const lhef::Event ttbar = makeEvent({{21, -1, 0, 0},
+                                         {21, -1, 0, 0},
+                                         {-6, 2, 1, 2},
+                                         {-24, 2, 3, 3},
+                                         {6, 2, 1, 2},
+                                         {24, 2, 5, 5},
+                                         {5, 1, 5, 5},
+                                         {-11, 1, 6, 6},
+                                         {12, 1, 6, 6},
+                                         {-5, 1, 3, 3},
+                                         {13, 1, 4, 4},
+                                         {-14, 1, 4, 4}});
+    lhef::DecayTree tree(ttbar);
+    if (!checkTTbar(tree, ttbar)) { return 1; }
+
+    // mothup = (m1, m2) with m1 < m2 is the range of the lines from m1 to m2,
+    // and (m2, m1) the two lines only.
+    const lhef::Event mothers = makeEvent({{21, -1, 0, 0},
+                                           {21, -1, 0, 0},
+                                           {23, 2, 1, 1},
+                                           {11, 1, 1, 3},
+                                           {-11, 1, 3, 1}});
+    tree.build(mothers);
+    bool ok =
+        check(sameLines(tree.daughterLines(1), {3, 4, 5}) &&
+                  sameLines(tree.daughterLines(2), {4}) &&
+                  sameLines(tree.daughterLines(3), {4, 5}),
+              "daughterLines of the mother ranges") &&
+        check(tree.finalDaughterLines(2) == lhef::ParticleLines{4} &&
+                  tree.finalDaughterLines(3) == lhef::ParticleLines{4, 5},
+              "finalDaughterLines of the mother ranges");
+
+    // The lines 3 and 4 are the mothers of each other. The walks must end.
+    const lhef::Event cyclic = makeEvent({{21, -1, 0, 0},
+                                          {21, -1, 0, 0},
+                                          {23, 2, 4, 4},
+                                          {23, 2, 3, 3},
+                                          {11, 1, 4, 4}});
+    tree.build(cyclic);
+    ok = ok &&
+         check(tree.isDescendant(3, 4) && tree.isDescendant(4, 3) &&
+                   tree.isDescendant(5, 3) && !tree.isDescendant(5, 1),
+               "isDescendant of the cyclic record") &&
+         check(tree.finalDaughterLines(3) == lhef::ParticleLines{5} &&
+                   tree.ancestorLine(5) == 0 &&
+                   lhef::ancestor(5, cyclic, tree).pid() == 0,
+               "the walks of the cyclic record");
+
+    // A rebuild reuses the storage, and must not keep the previous event.
+    tree.build(ttbar);
+    if (!ok || !checkTTbar(tree, ttbar)) { return 1; }
+    std::cout << "-- The decay trees agree.\n";
+}
@@ -0,0 +1,149 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "colevent_event_index.h"
+#include "lhco/lhco.h"
+#include "lhco/mapped_reader.h"
+#include "lhef/lhef.h"
+#include "lhef/mapped_reader.h"
+
+using colevent::EventFormat;
+
+bool isLHCO(const std::string &fname) {
+    return fname.find(".lhco") != std::string::npos;
+}
+
+std::string nextEventStr(std::istream *is, EventFormat format) {
+    std::ostringstream os;
+    if (format == EventFormat::LHEF) {
+        lhef::Event lhe;
+        if (lhef::parseEvent(is, &lhe)) { os << lhe; }
+    } else {
+        const auto lhco = lhco::parseRawEvent(is);
+        if (!lhco.empty()) { os << lhco; }
+    }
+    return os.str();
+}
+
+std::string nextEventStr(lhef::MappedReader *reader) {
+    std::ostringstream os;
+    lhef::Event lhe;
+    if (lhef::parseEvent(reader, &lhe)) { os << lhe; }
+    return os.str();
+}
+
+std::string nextEventStr(lhco::MappedReader *reader) {
+    std::ostringstream os;
+    lhco::RawEvent lhco;
+    if (reader->next(&lhco)) { os << lhco; }
+    return os.str();
+}
+
+// Reads the events of each shard with `selectEvents`.
+template <typename Reader>
+bool checkShards(const std::string &fname, const colevent::EventIndex &index,
+                 const std::vector<std::string> &events) {
+    for (const auto &shard : index.shards(3)) {
+        Reader reader(fname);
+        if (!reader.selectEvents(index, shard.first, shard.second)) {
+            std::cerr << "-- Cannot select the events of shard.\n";
+            return false;
+        }
+        std::size_t i = shard.first;
+        for (std::string ev; !(ev = nextEventStr(&reader)).empty(); ++i) {
+            if (i >= shard.second || ev != events[i]) {
+                std::cerr << "-- Event " << i << " differs in shard.\n";
+                return false;
+            }
+        }
+        if (i != shard.second) {
+            std::cerr << "-- Shard [" << shard.first << ", " << shard.second
+                      << ") is incomplete.\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cout << "Usage: test_event_index input\n"
+                  << "    - input: Input file in LHEF or LHCO format\n";
+        return 1;
+    }
+
+    const std::string fname(argv[1]);
+    const auto format = isLHCO(fname) ? EventFormat::LHCO : EventFormat::LHEF;
+    colevent::EventIndex index;
+    if (!colevent::loadIndex(fname, format, &index)) {
+        std::cerr << "-- Cannot index input file \"" << fname << "\".\n";
+        return 1;
+    }
+    std::cout << "-- " << index.size() << " events indexed in \"" << fname
+              << "\".\n";
+
+    colevent::EventIndex saved;
+    if (!colevent::readIndex(colevent::indexFileName(fname), &saved) ||
+        saved.offsets() != index.offsets() ||
+        saved.sourceMTime() != index.sourceMTime() ||
+        !colevent::isIndexOf(saved, fname) ||
+        !colevent::isIndexOf(saved, fname, true)) {
+        std::cerr << "-- Failed to read back the index.\n";
+        return 1;
+    }
+    colevent::EventIndex stale = saved;
+    stale.setSourceMTime(saved.sourceMTime() + 1);
+    if (colevent::isIndexOf(stale, fname)) {
+        std::cerr << "-- The index of a modified file is not stale.\n";
+        return 1;
+    }
+
+    // Every event found by seeking must be the same as the one read in order.
+    std::ifstream sequential(fname), random(fname);
+    std::vector<std::string> events;
+    for (std::size_t i = 0; i < index.size(); ++i) {
+        events.push_back(nextEventStr(&sequential, format));
+    }
+    if (!nextEventStr(&sequential, format).empty()) {
+        std::cerr << "-- Events missing in the index.\n";
+        return 1;
+    }
+    for (std::size_t i = index.size(); i-- > 0;) {
+        if (!colevent::seekEvent(&random, index, i) ||
+            nextEventStr(&random, format) != events[i]) {
+            std::cerr << "-- Event " << i << " differs.\n";
+            return 1;
+        }
+    }
+    std::cout << "-- Seeking to every event passed.\n";
+
+    for (std::size_t k : {1, 2, 3, 7}) {
+        const auto shards = index.shards(k);
+        std::size_t next = 0;
+        std::cout << "-- " << k << " shards:";
+        for (const auto &shard : shards) {
+            if (shard.first != next) {
+                std::cerr << "\n-- Shards are not contiguous.\n";
+                return 1;
+            }
+            next = shard.second;
+            std::cout << " [" << shard.first << ", " << shard.second << ")";
+        }
+        std::cout << '\n';
+        if (next != index.size()) {
+            std::cerr << "-- Shards do not cover all the events.\n";
+            return 1;
+        }
+    }
+
+    const bool ok = format == EventFormat::LHEF
+                        ? checkShards<lhef::MappedReader>(fname, index, events)
+                        : checkShards<lhco::MappedReader>(fname, index, events);
+    if (!ok) { return 1; }
+    std::cout << "-- Reading the shards with MappedReader passed.\n";
+}
@@ -0,0 +1,232 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <unistd.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "colevent_input.h"
+#include "lhco/lhco.h"
+#include "lhef/lhef.h"
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif  // HAVE_CONFIG_H
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif  // HAVE_ZLIB
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif  // HAVE_ZSTD
+#ifdef HAVE_LZMA
+#include <lzma.h>
+#endif  // HAVE_LZMA
+
+using colevent::Compression;
+
+// The data compressed by the library, or empty if it is not available.
+std::string compress(const std::string &data, Compression c) {
+    std::string out;
+    switch (c) {
+    case Compression::None:
+        return data;
+#ifdef HAVE_ZLIB
+    case Compression::Gzip: {
+        z_stream zs = {};
+        // 16: write the gzip header.
+        if (deflateInit2(&zs, 1, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) !=
+            Z_OK) {
+            return out;
+        }
+        out.resize(deflateBound(&zs, data.size()));
+        zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+        zs.avail_in = static_cast<uInt>(data.size());
+        zs.next_out = reinterpret_cast<Bytef *>(&out[0]);
+        zs.avail_out = static_cast<uInt>(out.size());
+        const bool ok = deflate(&zs, Z_FINISH) == Z_STREAM_END;
+        out.resize(ok ? zs.total_out : 0);
+        deflateEnd(&zs);
+        return out;
+    }
+#endif  // HAVE_ZLIB
+#ifdef HAVE_ZSTD
+    case Compression::Zstd: {
+        out.resize(ZSTD_compressBound(data.size()));
+        const std::size_t n =
+            ZSTD_compress(&out[0], out.size(), data.data(), data.size(), 1);
+        out.resize(ZSTD_isError(n) ? 0 : n);
+        return out;
+    }
+#endif  // HAVE_ZSTD
+#ifdef HAVE_LZMA
+    case Compression::Xz: {
+        out.resize(lzma_stream_buffer_bound(data.size()));
+        std::size_t n = 0;
+        const bool ok =
+            lzma_easy_buffer_encode(
+                1, LZMA_CHECK_CRC64, nullptr,
+                reinterpret_cast<const uint8_t *>(data.data()), data.size(),
+                reinterpret_cast<uint8_t *>(&out[0]), &n,
+                out.size()) == LZMA_OK;
+        out.resize(ok ? n : 0);
+        return out;
+    }
+#endif  // HAVE_LZMA
+    default:
+        return out;
+    }
+}
+
+// A new empty file in the temporary directory, so that nothing is written next
+// to the input. It returns an empty string if the file cannot be created.
+std::string temporaryFile() {
+    const char *dir = std::getenv("TMPDIR");
+    std::string fname =
+        std::string(dir && *dir ? dir : "/tmp") + "/test_input.XXXXXX";
+    const int fd = ::mkstemp(&fname[0]);
+    if (fd < 0) { return std::string(); }
+    ::close(fd);
+    return fname;
+}
+
+bool writeFile(const std::string &fname, const std::string &data) {
+    std::ofstream os(fname, std::ios::binary);
+    os.write(data.data(), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(os);
+}
+
+// Reads the whole file through `openInput`.
+bool readInput(const std::string &fname, Compression c, std::string *data,
+               colevent::InputStats *stats) {
+    auto fin = colevent::openInput(fname);
+    if (!*fin || fin->compression() != c) { return false; }
+    data->assign(std::istreambuf_iterator<char>(*fin),
+                 std::istreambuf_iterator<char>());
+    *stats = fin->stats();
+    return true;
+}
+
+std::vector<std::string> events(std::istream *is, bool is_lhco) {
+    std::vector<std::string> evs;
+    for (;;) {
+        std::ostringstream os;
+        if (is_lhco) {
+            const auto lhco = lhco::parseRawEvent(is);
+            if (lhco.empty()) { break; }
+            os << lhco;
+        } else {
+            lhef::Event lhe;
+            if (!lhef::parseEvent(is, &lhe)) { break; }
+            os << lhe;
+        }
+        evs.push_back(os.str());
+    }
+    return evs;
+}
+
+bool check(bool ok, Compression c, const std::string &what) {
+    if (!ok) {
+        std::cerr << "-- " << what << " (" << colevent::show(c)
+                  << ") failed.\n";
+    }
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cout << "Usage: test_input input\n"
+                  << "    - input: Uncompressed input file in LHEF or "
+                  << "LHC Olympics format (*.lhco)\n";
+        return 1;
+    }
+
+    const std::string fname(argv[1]);
+    std::ifstream fin(fname, std::ios::binary);
+    if (!fin) {
+        std::cerr << "-- Cannot open input file \"" << fname << "\".\n";
+        return 1;
+    }
+    const std::string data((std::istreambuf_iterator<char>(fin)),
+                           std::istreambuf_iterator<char>());
+    fin.clear();
+    fin.seekg(0);
+    const bool is_lhco = fname.find(".lhco") != std::string::npos;
+    const auto expected = events(&fin, is_lhco);
+    if (expected.empty()) {
+        std::cerr << "-- No events in \"" << fname << "\".\n";
+        return 1;
+    }
+
+    // Several rounds of the ring of the decompressed blocks.
+    std::string large;
+    while (large.size() < (std::size_t(10) << 20)) { large += data; }
+
+    const std::string tmp = temporaryFile();
+    if (tmp.empty()) {
+        std::cerr << "-- Cannot create a temporary file.\n";
+        return 1;
+    }
+    bool ok = true;
+    for (auto c : {Compression::None, Compression::Gzip, Compression::Zstd,
+                   Compression::Xz}) {
+        if (!colevent::isSupported(c)) {
+            std::cout << "-- Built without " << colevent::show(c) << ".\n";
+            continue;
+        }
+        const std::string compressed = compress(data, c);
+        if (!check(!compressed.empty(), c, "Compressing")) {
+            std::remove(tmp.c_str());
+            return 1;
+        }
+
+        std::string decoded;
+        colevent::InputStats stats;
+        ok = check(writeFile(tmp, compressed) &&
+                       readInput(tmp, c, &decoded, &stats) &&
+                       decoded == data && !stats.error &&
+                       stats.compressed_bytes == compressed.size() &&
+                       stats.decompressed_bytes == data.size(),
+                   c, "Round trip") &&
+             ok;
+
+        auto is = colevent::openInput(tmp);
+        ok = check(events(is.get(), is_lhco) == expected, c, "Parsing") && ok;
+
+        ok = check(writeFile(tmp, compress(large, c)) &&
+                       readInput(tmp, c, &decoded, &stats) &&
+                       decoded == large && !stats.error,
+                   c, "Round trip of large data") &&
+             ok;
+
+        if (c == Compression::None) { continue; }
+
+        // The members of a gzip file, or the streams of a zstd or xz file,
+        // may be concatenated.
+        const std::size_t half = data.size() / 2;
+        ok = check(writeFile(tmp, compress(data.substr(0, half), c) +
+                                      compress(data.substr(half), c)) &&
+                       readInput(tmp, c, &decoded, &stats) &&
+                       decoded == data && !stats.error,
+                   c, "Round trip of concatenated data") &&
+             ok;
+
+        // A truncated file gives a prefix of the data and the error.
+        const std::string truncated =
+            compressed.substr(0, compressed.size() / 2);
+        ok = check(writeFile(tmp, truncated) &&
+                       readInput(tmp, c, &decoded, &stats) &&
+                       decoded == data.substr(0, decoded.size()) &&
+                       stats.error,
+                   c, "Reading truncated data") &&
+             ok;
+        std::cout << "-- " << colevent::show(c) << ": "
+                  << (ok ? "passed" : "failed") << ".\n";
+    }
+    std::remove(tmp.c_str());
+    if (!ok) { return 1; }
+    std::cout << "-- Reading through openInput agrees with the input.\n";
+}
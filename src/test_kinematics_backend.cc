@@ -0,0 +1,118 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "colevent_constants.h"
+#include "colevent_kinematics.h"
+
+bool isClose(double a, double b, double tolerance) {
+    return std::abs(a - b) <= tolerance * std::max(1.0, std::abs(b));
+}
+
+// Momenta with pT from 1 MeV to 10 TeV over |eta| < 5, and at rest.
+std::vector<colevent::FourMomentum> randomMomenta(std::size_t n) {
+    std::mt19937_64 rng(2026);
+    std::uniform_real_distribution<double> log_pt(-3.0, 4.0), eta(-5.0, 5.0),
+        phi(-colevent::PI, colevent::PI), mass(0.0, 100.0);
+    std::vector<colevent::FourMomentum> momenta;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double pt = std::pow(10.0, log_pt(rng)), phi_ = phi(rng);
+        const double px = pt * std::cos(phi_), py = pt * std::sin(phi_),
+                     pz = pt * std::sinh(eta(rng)), m = mass(rng);
+        momenta.push_back({colevent::Energy(std::hypot(pt, pz, m)),
+                           colevent::Px(px), colevent::Py(py),
+                           colevent::Pz(pz)});
+    }
+    momenta.push_back({colevent::Energy(1.0), colevent::Px(0.0),
+                       colevent::Py(0.0), colevent::Pz(0.0)});
+    return momenta;
+}
+
+// The native functions against the definitions in terms of the pT.
+bool checkNative(const std::vector<colevent::FourMomentum> &momenta) {
+    for (std::size_t i = 0; i + 1 < momenta.size(); ++i) {
+        const auto &p = momenta[i], &q = momenta[i + 1];
+        const colevent::Px px(p.px());
+        const colevent::Py py(p.py());
+        const colevent::Pz pz(p.pz());
+        const double ptot = std::hypot(p.pt(), p.pz());
+        const double dphi = colevent::deltaPhi(p, q);
+        if (!isClose(colevent::cosTheta(px, py, pz), p.pz() / ptot, 1e-15) ||
+            !isClose(colevent::pseudoRapidity(px, py, pz),
+                     std::asinh(p.pz() / p.pt()), 1e-9) ||
+            dphi < -colevent::PI || dphi >= colevent::PI ||
+            !isClose(
+                std::remainder(dphi - (p.phi() - q.phi()), colevent::TWOPI),
+                0.0, 1e-15) ||
+            colevent::deltaR(p, q) != std::hypot(p.eta() - q.eta(), dphi)) {
+            std::cerr << "-- The native functions differ at " << i << ".\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// The same momenta by the native and the ROOT functions.
+bool checkRoot(const std::vector<colevent::FourMomentum> &momenta) {
+    std::vector<std::array<double, 4>> results[2];
+    for (auto backend : {colevent::KinematicsBackend::Native,
+                         colevent::KinematicsBackend::ROOT}) {
+        colevent::setKinematicsBackend(backend);
+        auto &result = results[static_cast<int>(backend)];
+        for (std::size_t i = 0; i + 2 < momenta.size(); ++i) {
+            const auto &p = momenta[i], &q = momenta[i + 1];
+            const colevent::Px px(p.px());
+            const colevent::Py py(p.py());
+            const colevent::Pz pz(p.pz());
+            result.push_back({colevent::cosTheta(px, py, pz),
+                              colevent::pseudoRapidity(px, py, pz),
+                              colevent::deltaPhi(p, q),
+                              colevent::deltaR(p, q)});
+        }
+    }
+    colevent::setKinematicsBackend(colevent::KinematicsBackend::Native);
+    for (std::size_t i = 0; i < results[0].size(); ++i) {
+        for (int j = 0; j < 4; ++j) {
+            if (!isClose(results[1][i][j], results[0][i][j], 1e-12)) {
+                std::cerr << "-- The ROOT function " << j << " differs at "
+                          << i << ": " << results[1][i][j] << " and "
+                          << results[0][i][j] << '\n';
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// `CM22` conserves the four-momentum, and its particles are on shell.
+bool checkCM22() {
+    const std::array<double, 4> m = {0.0, 0.0, 173.0, 173.0};
+    const double s = 1000.0 * 1000.0;
+    const colevent::CM22 cm(m, s, 0.3, 0.7);
+    const auto in = cm.p1() + cm.p2(), out = cm.k1() + cm.k2();
+    const bool ok = isClose(in.energy(), std::sqrt(s), 1e-12) &&
+                    isClose(out.energy(), in.energy(), 1e-12) &&
+                    isClose(out.pz(), 0.0, 1e-9) &&
+                    isClose(out.px(), 0.0, 1e-9) &&
+                    isClose(cm.k1().mass(), m[2], 1e-9) &&
+                    isClose(cm.t() + cm.u(), 2 * m[2] * m[2] - s, 1e-9);
+    if (!ok) { std::cerr << "-- CM22 does not conserve the momentum.\n"; }
+    return ok;
+}
+
+int main() {
+    const auto momenta = randomMomenta(100000);
+    if (!checkNative(momenta) || !checkCM22()) { return 1; }
+    std::cout << "-- The native functions agree with the definitions.\n";
+
+    if (!colevent::setKinematicsBackend(colevent::KinematicsBackend::ROOT)) {
+        std::cout << "-- Built without ROOT: no cross-check.\n";
+        return 0;
+    }
+    if (!checkRoot(momenta)) { return 1; }
+    std::cout << "-- The native and the ROOT functions agree.\n";
+}
@@ -0,0 +1,94 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "lhco/lhco.h"
+
+// The Cartesian components as the constructors computed them before they
+// were computed in the accessors.
+struct Eager {
+    double px, py, pz, e;
+
+    explicit Eager(const lhco::Visible &p) {
+        px = p.pt() * std::cos(p.phi());
+        py = p.pt() * std::sin(p.phi());
+        pz = p.pt() * std::sinh(p.eta());
+        if (p.mass() > 0.0) {
+            e = std::sqrt(p.pt() * p.pt() + pz * pz + p.mass() * p.mass());
+        } else {
+            e = std::sqrt(p.pt() * p.pt() + pz * pz);
+        }
+    }
+};
+
+// Accesses the components in different orders, and through a copy.
+bool sameMomentum(const lhco::Visible &p, int order) {
+    const Eager expected(p);
+    const lhco::Visible copy = p;
+    double px, py, pz, e;
+    if (order % 2 == 0) {
+        px = p.px(), py = p.py(), pz = p.pz(), e = p.energy();
+    } else {
+        e = p.energy(), pz = p.pz(), py = p.py(), px = p.px();
+    }
+    return px == expected.px && py == expected.py && pz == expected.pz &&
+           e == expected.e && copy.px() == px && copy.energy() == e;
+}
+
+template <typename T>
+bool sameMomenta(const std::vector<T> &ps, int order) {
+    for (const auto &p : ps) {
+        if (!sameMomentum(p, order)) { return false; }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cout << "Usage: test_momentum_lhco input\n"
+                  << "    - input: Input file in "
+                  << "LHC Olympics format\n";
+        return 1;
+    }
+
+    std::ifstream filename(argv[1]);
+    if (!filename) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    int num_eve = 0;
+    for (auto ev = lhco::parseEvent(&filename); !ev.done();
+         ev = lhco::parseEvent(&filename), ++num_eve) {
+        const auto &met = ev.met();
+        if (!sameMomenta(ev.photons(), num_eve) ||
+            !sameMomenta(ev.electrons(), num_eve) ||
+            !sameMomenta(ev.muons(), num_eve) ||
+            !sameMomenta(ev.taus(), num_eve) ||
+            !sameMomenta(ev.jets(), num_eve) ||
+            !sameMomenta(ev.bjets(), num_eve) ||
+            met.px() != met.pt() * std::cos(met.phi()) ||
+            met.py() != met.pt() * std::sin(met.phi())) {
+            std::cerr << "-- The momenta of event " << num_eve + 1
+                      << " differ.\n";
+            return 1;
+        }
+    }
+
+    std::mt19937_64 gen(20260103);
+    std::uniform_real_distribution<double> uniform(-10.0, 10.0);
+    for (int i = 0; i < 100000; ++i) {
+        const lhco::Jet jet{colevent::Pt{100.0 * std::abs(uniform(gen))},
+                            colevent::Eta{uniform(gen)},
+                            colevent::Phi{uniform(gen)},
+                            colevent::Mass{i % 3 ? uniform(gen) : 0.0}, 3};
+        if (!sameMomentum(jet, i)) {
+            std::cerr << "-- The momenta of a random jet differ.\n";
+            return 1;
+        }
+    }
+
+    std::cout << "-- The momenta of " << num_eve << " events agree.\n";
+}
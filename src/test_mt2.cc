@@ -0,0 +1,139 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "colevent_kinematics.h"
+#include "colevent_mt2.h"
+#include "colevent_simd.h"
+#include "lester_mt2_bisect.h"
+
+// Visible systems with masses up to 100 GeV and pT around 50 GeV, and
+// random missing transverse momenta.
+colevent::MT2Columns randomEvents(std::size_t n) {
+    std::mt19937_64 rng(2026);
+    std::exponential_distribution<double> pt(1.0 / 50.0);
+    std::uniform_real_distribution<double> phi(-colevent::PI, colevent::PI),
+        mass(0.0, 100.0), pz(-100.0, 100.0);
+    auto visible = [&]() {
+        const double p_t = pt(rng), phi_ = phi(rng), m = mass(rng),
+                     p_z = pz(rng);
+        return colevent::FourMomentum{
+            colevent::Energy(std::hypot(p_t, p_z, m)),
+            colevent::Px(p_t * std::cos(phi_)),
+            colevent::Py(p_t * std::sin(phi_)), colevent::Pz(p_z)};
+    };
+    colevent::MT2Columns events;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto vis1 = visible(), vis2 = visible();
+        const double met = pt(rng), phi_ = phi(rng);
+        events.add(vis1, vis2, met * std::cos(phi_), met * std::sin(phi_));
+    }
+
+    // At rest, massless, and back to back, where the ellipses of the two
+    // sides are the same for equal invisible masses.
+    const colevent::FourMomentum rest, massless{
+        colevent::Energy(50.0), colevent::Px(30.0), colevent::Py(0.0),
+        colevent::Pz(40.0)};
+    events.add(rest, rest, 0.0, 0.0);
+    events.add(massless, massless, -60.0, 0.0);
+    events.add(massless, -massless, 0.0, 0.0);
+    return events;
+}
+
+int main() {
+    asymm_mt2_lester_bisect::disableCopyrightMessage();
+
+    // Not a multiple of the chunk sizes.
+    const auto events = randomEvents(2998);
+    const std::vector<colevent::MT2Hypothesis> hypotheses = {
+        {0.0, 0.0}, {10.0, 10.0}, {0.0, 80.0}, {100.0, 50.0}};
+    const std::size_t h = hypotheses.size();
+    const double coarse = 1e-3;
+
+    // MT2 to the machine precision and to the coarse precision.
+    std::vector<double> expected(events.size() * h),
+        expected_coarse(events.size() * h);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        for (std::size_t k = 0; k < h; ++k) {
+            const double m_inv1 = hypotheses[k].m_inv1,
+                         m_inv2 = hypotheses[k].m_inv2;
+            const double mt2 = colevent::mT2(
+                events.m_vis1[i], events.px_vis1[i], events.py_vis1[i],
+                events.m_vis2[i], events.px_vis2[i], events.py_vis2[i],
+                events.px_miss[i], events.py_miss[i], m_inv1, m_inv2);
+            // MT2 is not less than the masses of the parents at rest, and is
+            // symmetric under the exchange of the sides. It is negative if the
+            // calculation fails, e.g., for the ellipses at rest.
+            const double swapped = colevent::mT2(
+                events.m_vis2[i], events.px_vis2[i], events.py_vis2[i],
+                events.m_vis1[i], events.px_vis1[i], events.py_vis1[i],
+                events.px_miss[i], events.py_miss[i], m_inv2, m_inv1);
+            const double m_min = std::max(events.m_vis1[i] + m_inv1,
+                                          events.m_vis2[i] + m_inv2);
+            if ((mt2 >= 0.0 && mt2 < m_min * (1.0 - 1e-12)) ||
+                std::abs(mt2 - swapped) > 1e-9 * std::abs(mt2)) {
+                std::cerr << "-- MT2 of event " << i << " is wrong: " << mt2
+                          << ", " << swapped << ", " << m_min << '\n';
+                return 1;
+            }
+            expected[i * h + k] = mt2;
+            expected_coarse[i * h + k] = colevent::mT2(
+                events.m_vis1[i], events.px_vis1[i], events.py_vis1[i],
+                events.m_vis2[i], events.px_vis2[i], events.py_vis2[i],
+                events.px_miss[i], events.py_miss[i], m_inv1, m_inv2, coarse);
+        }
+    }
+
+    // The scalar MT2 is the same as the reference at any precision, and so is
+    // the vectorized one to the machine precision. With the coarse precision,
+    // the lanes may stop the bisection at other steps than the reference, so
+    // the vectorized MT2 is only within the precision of the exact one.
+    for (auto level : {colevent::SimdLevel::Scalar, colevent::SimdLevel::AVX2,
+                       colevent::SimdLevel::AVX512}) {
+        if (level > colevent::supportedSimdLevel()) { continue; }
+        colevent::setSimdLevel(level);
+        for (double precision : {0.0, coarse}) {
+            const bool exact =
+                level == colevent::SimdLevel::Scalar || precision == 0.0;
+            const auto &reference =
+                precision == 0.0 || !exact ? expected : expected_coarse;
+            for (unsigned num_threads : {1, 3}) {
+                for (std::size_t chunk_size : {1, 100, 5000}) {
+                    colevent::MT2Options opts;
+                    opts.num_threads = num_threads;
+                    opts.chunk_size = chunk_size;
+                    opts.precision = precision;
+                    opts.print_copyright = false;
+                    std::vector<double> mt2;
+                    colevent::mT2Matrix(events, hypotheses, &mt2, opts);
+                    double max_diff = 0.0;
+                    for (std::size_t i = 0; i < mt2.size(); ++i) {
+                        const double diff = std::abs(mt2[i] - reference[i]);
+                        max_diff = std::max(max_diff, diff);
+                        if (exact ? mt2[i] != reference[i]
+                                  : !(diff <= std::max(precision,
+                                                       1e-12 * reference[i]))) {
+                            std::cerr << "-- The " << colevent::show(level)
+                                      << " MT2 of " << num_threads
+                                      << " threads and chunks of "
+                                      << chunk_size << " events differs at "
+                                      << i << ": " << mt2[i] << ", "
+                                      << reference[i] << '\n';
+                            return 1;
+                        }
+                    }
+                    if (num_threads == 1 && chunk_size == 100) {
+                        std::cout << "-- " << colevent::show(level)
+                                  << ", precision " << precision
+                                  << ": max difference " << max_diff << '\n';
+                    }
+                }
+            }
+        }
+    }
+    std::cout << "-- The MT2 matrices of " << events.size() << " events and "
+              << h << " hypotheses agree.\n";
+}
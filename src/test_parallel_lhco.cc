@@ -0,0 +1,123 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "lhco/lhco.h"
+#include "lhco/parallel_reader.h"
+
+// The events of a text read one by one with `lhco::parseEvent`.
+std::vector<std::string> readSequential(const std::string &text) {
+    std::vector<std::string> events;
+    lhco::Event ev;
+    for (const char *pos = text.data();
+         (pos = lhco::parseEvent(pos, text.data() + text.size(), &ev)),
+         !ev.done();) {
+        events.push_back(ev.show());
+    }
+    return events;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cout << "Usage: test_parallel_lhco input\n"
+                  << "    - input: Input file in "
+                  << "LHC Olympics format\n";
+        return 1;
+    }
+
+    std::ifstream filename(argv[1]);
+    if (!filename) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    std::ostringstream buffer;
+    buffer << filename.rdbuf();
+    const std::string text = buffer.str();
+    const auto expected = readSequential(text);
+
+    // Small chunks, so that the events are split into many of them.
+    lhco::ParallelOptions opts;
+    opts.num_threads = 4;
+    opts.chunk_size = 4096;
+
+    std::vector<std::string> ordered;
+    int last_number = -1;
+    bool in_order = true;
+    long num_eve = lhco::parseEventsParallel(
+        text.data(), text.data() + text.size(),
+        [&](const lhco::Event &ev) {
+            ordered.push_back(ev.show());
+            in_order = in_order && ev.header().event_number > last_number;
+            last_number = ev.header().event_number;
+        },
+        opts);
+    if (num_eve != static_cast<long>(expected.size()) || ordered != expected ||
+        !in_order) {
+        std::cerr << "-- The ordered events differ.\n";
+        return 1;
+    }
+
+    opts.ordered = false;
+    std::mutex mutex;
+    long num_chars = 0, expected_chars = 0;
+    for (const auto &ev : expected) { expected_chars += ev.size(); }
+    num_eve = lhco::parseEventsParallel(
+        text.data(), text.data() + text.size(),
+        [&](const lhco::Event &ev) {
+            const std::string str = ev.show();
+            std::lock_guard<std::mutex> lock(mutex);
+            num_chars += str.size();
+        },
+        opts);
+    if (num_eve != static_cast<long>(expected.size()) ||
+        num_chars != expected_chars) {
+        std::cerr << "-- The unordered events differ.\n";
+        return 1;
+    }
+
+    // Put an undefined line into every 10th event. The events are skipped
+    // and reported, while the others are read.
+    const std::string undefined = "  1    9    0.0    0.0    0.0";
+    std::string corrupted;
+    std::vector<std::size_t> line_numbers;
+    std::size_t line_number = 0, num_header = 0;
+    std::istringstream lines(text);
+    for (std::string line; std::getline(lines, line);) {
+        corrupted += line + '\n';
+        ++line_number;
+        if (lhco::findHeaderLine(line.data(), line.data() + line.size()) ==
+                line.data() &&
+            num_header++ % 10 == 0) {
+            corrupted += undefined + '\n';
+            line_numbers.push_back(++line_number);
+        }
+    }
+
+    opts.ordered = true;
+    std::vector<lhco::UndefinedLine> undefined_lines;
+    num_eve = lhco::parseEventsParallel(
+        corrupted.data(), corrupted.data() + corrupted.size(),
+        [](const lhco::Event &) {}, opts, &undefined_lines);
+    const long num_skipped = static_cast<long>(line_numbers.size());
+    if (num_eve + num_skipped != static_cast<long>(expected.size()) ||
+        undefined_lines.size() != line_numbers.size()) {
+        std::cerr << "-- " << num_eve << " events read and "
+                  << undefined_lines.size() << " undefined lines reported.\n";
+        return 1;
+    }
+    for (std::size_t i = 0; i < undefined_lines.size(); ++i) {
+        const auto &line = undefined_lines[i];
+        if (line.line_number != line_numbers[i] || line.text != undefined ||
+            corrupted.compare(line.offset, undefined.size(), undefined) != 0) {
+            std::cerr << "-- The undefined line " << i << " differs.\n";
+            return 1;
+        }
+    }
+
+    std::cout << "-- " << expected.size() << " events read in parallel, "
+              << undefined_lines.size() << " undefined lines reported.\n";
+}
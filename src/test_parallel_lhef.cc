@@ -0,0 +1,123 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "lhef/lhef.h"
+#include "lhef/mapped_reader.h"
+#include "lhef/parallel_reader.h"
+
+std::string showEvent(const lhef::Event &lhe) {
+    std::ostringstream os;
+    os << lhe;
+    return os.str();
+}
+
+// Reads the text in parallel, in order and out of order, and compares the
+// events with `expected` for chunks smaller than an event and larger.
+bool checkParallel(const std::string &text,
+                   const std::vector<std::string> &expected,
+                   const std::string &what) {
+    std::vector<std::string> sorted = expected;
+    std::sort(sorted.begin(), sorted.end());
+
+    lhef::ParallelOptions opts;
+    opts.num_threads = 4;
+    for (std::size_t chunk_size : {1, 100, 1000, 4096, 1 << 20}) {
+        opts.chunk_size = chunk_size;
+
+        opts.ordered = true;
+        std::vector<std::string> ordered;
+        long num_eve = lhef::parseEventsParallel(
+            text.data(), text.data() + text.size(),
+            [&ordered](const lhef::Event &lhe) {
+                ordered.push_back(showEvent(lhe));
+            },
+            opts);
+        if (num_eve != static_cast<long>(expected.size()) ||
+            ordered != expected) {
+            std::cerr << "-- The ordered events of " << what
+                      << " differ for chunks of " << chunk_size
+                      << " bytes: " << num_eve << " events read.\n";
+            return false;
+        }
+
+        opts.ordered = false;
+        std::mutex mutex;
+        std::vector<std::string> unordered;
+        num_eve = lhef::parseEventsParallel(
+            text.data(), text.data() + text.size(),
+            [&mutex, &unordered](const lhef::Event &lhe) {
+                const std::string str = showEvent(lhe);
+                std::lock_guard<std::mutex> lock(mutex);
+                unordered.push_back(str);
+            },
+            opts);
+        std::sort(unordered.begin(), unordered.end());
+        if (num_eve != static_cast<long>(expected.size()) ||
+            unordered != sorted) {
+            std::cerr << "-- The unordered events of " << what
+                      << " differ for chunks of " << chunk_size
+                      << " bytes: " << num_eve << " events read.\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cout << "Usage: test_parallel_lhef input\n"
+                  << "    - input: Input file in LHEF format\n";
+        return 1;
+    }
+
+    std::ifstream filename(argv[1]);
+    if (!filename) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    std::ostringstream buffer;
+    buffer << filename.rdbuf();
+    const std::string text = buffer.str();
+
+    std::vector<std::string> expected;
+    lhef::MappedReader reader(argv[1]);
+    for (lhef::Event lhe; lhef::parseEvent(&reader, &lhe);) {
+        expected.push_back(showEvent(lhe));
+    }
+    if (expected.empty()) {
+        std::cerr << "-- No events in \"" << argv[1] << "\".\n";
+        return 1;
+    }
+    if (!checkParallel(text, expected, "the input")) { return 1; }
+
+    // Put an empty event before every 10th event. The sequential readers stop
+    // at the first of them, while the parallel reader skips all of them.
+    std::string with_empty;
+    std::size_t num_empty = 0;
+    for (std::size_t pos = 0, num_tag = 0;;) {
+        const std::size_t tag = text.find("<event", pos);
+        if (tag == std::string::npos) {
+            with_empty += text.substr(pos);
+            break;
+        }
+        with_empty += text.substr(pos, tag - pos);
+        if (num_tag++ % 10 == 0) {
+            with_empty += "<event>\n</event>\n";
+            ++num_empty;
+        }
+        with_empty += "<event";
+        pos = tag + 6;
+    }
+    if (!checkParallel(with_empty, expected, "the input with empty events")) {
+        return 1;
+    }
+
+    std::cout << "-- " << expected.size() << " events read in parallel, "
+              << num_empty << " empty events skipped.\n";
+}
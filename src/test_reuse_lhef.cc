@@ -0,0 +1,97 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include "lhef/lhef.h"
+
+// Counts every allocation made through the global operator new.
+static long num_alloc = 0;
+
+void *operator new(std::size_t size) {
+    ++num_alloc;
+    if (void *p = std::malloc(size == 0 ? 1 : size)) { return p; }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete[](void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+lhef::Event mkEvent(int nup) {
+    lhef::EventInfo evinfo(nup, 0, 0.2504000E-03, 0.1859065E+03,
+                           0.7546771E-02, 0.1168023E+00);
+    lhef::EventEntry entry;
+    for (int i = 1; i <= nup; ++i) {
+        entry.insert({i, lhef::Particle(21, i < 3 ? -1 : 1, 1, 2, 501, 502,
+                                        0.1 * i, -0.2 * i, 0.60610394285E+02,
+                                        0.60610394285E+02 + i, 0.0, 0., -1.)});
+    }
+    return lhef::Event(evinfo, entry);
+}
+
+std::string mkLHEF() {
+    std::ostringstream os;
+    os << lhef::openingLine() << '\n';
+    for (int nup : {12, 14, 10, 16, 13, 12, 9, 15}) {
+        os << mkEvent(nup) << '\n';
+    }
+    os << lhef::closingLine() << '\n';
+    return os.str();
+}
+
+// Reads all the events in `is` and returns the number of events.
+int readAll(std::istream *is, lhef::Event *lhe) {
+    int num_eve = 0;
+    while (lhef::parseEvent(is, lhe)) { ++num_eve; }
+    return num_eve;
+}
+
+int main() {
+    const std::string lhef_str = mkLHEF();
+    std::istringstream iss(lhef_str);
+    lhef::Event lhe;
+
+    std::cout << "-- Warming up ...\n";
+    const int num_eve = readAll(&iss, &lhe);
+
+    iss.clear();
+    iss.seekg(0);
+    const long num_alloc_before = num_alloc;
+    int num_eve_reuse = 0;
+    for (int i = 0; i < 100; ++i) {
+        num_eve_reuse += readAll(&iss, &lhe);
+        iss.clear();
+        iss.seekg(0);
+    }
+    const long num_alloc_steady = num_alloc - num_alloc_before;
+
+    std::cout << "-- " << num_eve_reuse << " events parsed with "
+              << num_alloc_steady << " allocations.\n";
+    if (num_eve_reuse != 100 * num_eve || num_alloc_steady != 0) {
+        std::cerr << "-- Failed.\n";
+        return 1;
+    }
+
+    // The events read in place must be the same as the ones built afresh.
+    iss.seekg(0);
+    std::istringstream iss_fresh(lhef_str);
+    while (lhef::parseEvent(&iss, &lhe)) {
+        std::ostringstream os_reuse, os_fresh;
+        os_reuse << lhe;
+        os_fresh << lhef::parseEvent(&iss_fresh);
+        if (os_reuse.str() != os_fresh.str()) {
+            std::cerr << "-- Failed: the reused event differs.\n";
+            return 1;
+        }
+    }
+    std::cout << "-- Passed.\n";
+}
@@ -0,0 +1,82 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "lhco/lhco.h"
+#include "lhco/mapped_reader.h"
+#include "lhef/lhef.h"
+#include "lhef/mapped_reader.h"
+
+bool isLHCO(const std::string &fname) {
+    return fname.find(".lhco") != std::string::npos;
+}
+
+// The events after skipping `n` events and reading every `k`-th event, or
+// all the events if `n` is 0 and `k` is 1. `*num_skipped` is the return
+// value of `skip(n)`.
+template <typename Reader, typename Event, typename Next>
+std::vector<std::string> readEvents(const std::string &fname, std::size_t n,
+                                    std::size_t k, std::size_t *num_skipped,
+                                    Next next) {
+    Reader reader(fname);
+    *num_skipped = reader.skip(n);
+    reader.prescale(k);
+    std::vector<std::string> events;
+    for (Event ev; next(&reader, &ev);) { events.push_back(show(ev)); }
+    return events;
+}
+
+std::vector<std::string> readEvents(const std::string &fname, std::size_t n,
+                                    std::size_t k, std::size_t *num_skipped) {
+    if (isLHCO(fname)) {
+        return readEvents<lhco::MappedReader, lhco::Event>(
+            fname, n, k, num_skipped,
+            [](lhco::MappedReader *reader, lhco::Event *ev) {
+                return reader->next(ev);
+            });
+    }
+    return readEvents<lhef::MappedReader, lhef::Event>(
+        fname, n, k, num_skipped,
+        [](lhef::MappedReader *reader, lhef::Event *lhe) {
+            return lhef::parseEvent(reader, lhe);
+        });
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cout << "Usage: test_skip input\n"
+                  << "    - input: Input file in LHEF or "
+                  << "LHC Olympics format\n";
+        return 1;
+    }
+
+    const std::string fname(argv[1]);
+    std::size_t num_skipped;
+    const auto all = readEvents(fname, 0, 1, &num_skipped);
+    if (all.empty()) {
+        std::cerr << "-- Cannot read events from \"" << fname << "\".\n";
+        return 1;
+    }
+
+    const std::size_t num_eve = all.size();
+    for (const std::size_t n : {std::size_t(0), std::size_t(1), num_eve / 3,
+                                num_eve - 1, num_eve, num_eve + 10}) {
+        for (const std::size_t k : {1, 2, 7}) {
+            std::vector<std::string> expected;
+            for (std::size_t i = n; i < num_eve; i += k) {
+                expected.push_back(all[i]);
+            }
+            const auto events = readEvents(fname, n, k, &num_skipped);
+            if (num_skipped != std::min(n, num_eve) || events != expected) {
+                std::cerr << "-- The events after skip(" << n
+                          << ") and prescale(" << k << ") differ.\n";
+                return 1;
+            }
+        }
+    }
+    std::cout << "-- " << num_eve << " events of \"" << fname
+              << "\" skipped and prescaled.\n";
+}
@@ -0,0 +1,79 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "lhef/event_view.h"
+#include "lhef/lhef.h"
+#include "lhef/mapped_reader.h"
+
+std::string render(const lhef::Event &lhe) {
+    std::ostringstream os;
+    os << lhe;
+    return os.str();
+}
+
+bool sameInfo(const lhef::EventInfo &a, const lhef::EventInfo &b) {
+    return a.nup == b.nup && a.idprup == b.idprup && a.xwgtup == b.xwgtup &&
+           a.scalup == b.scalup && a.aqedup == b.aqedup &&
+           a.aqcdup == b.aqcdup;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cout << "Usage: test_view_lhef input\n"
+                  << "    - input: Input file in "
+                  << "Les Houches Event File format\n";
+        return 1;
+    }
+
+    lhef::MappedReader eager_reader(argv[1]), view_reader(argv[1]);
+    std::ifstream filename(argv[1]);
+    if (!eager_reader || !view_reader || !filename) {
+        std::cerr << "-- Cannot open input file \"" << argv[1] << "\".\n";
+        return 1;
+    }
+
+    lhef::Event lhe, from_view;
+    lhef::EventView view, stream_view;
+    int num_eve = 0;
+    while (lhef::parseEvent(&eager_reader, &lhe)) {
+        ++num_eve;
+        if (!lhef::parseEvent(&view_reader, &view) ||
+            !lhef::parseEvent(&filename, &stream_view) ||
+            !sameInfo(view.eventInfo(), lhe.eventInfo()) ||
+            !sameInfo(stream_view.eventInfo(), lhe.eventInfo())) {
+            std::cerr << "-- EventInfo of event " << num_eve << " differs.\n";
+            return 1;
+        }
+
+        // Access the last particle first so that the lines are parsed out of
+        // order.
+        const auto &last = view.at(view.size());
+        const auto &expected = lhe.particleEntries().at(lhe.eventInfo().nup);
+        if (last.pid() != expected.pid() || last.px() != expected.px()) {
+            std::cerr << "-- The last particle of event " << num_eve
+                      << " differs.\n";
+            return 1;
+        }
+
+        view.toEvent(&from_view);
+        const std::string expected_str = render(lhe);
+        if (render(from_view) != expected_str) {
+            std::cerr << "-- Event " << num_eve << " differs.\n";
+            return 1;
+        }
+        stream_view.toEvent(&from_view);
+        if (render(from_view) != expected_str) {
+            std::cerr << "-- Event " << num_eve << " from stream differs.\n";
+            return 1;
+        }
+    }
+    if (lhef::parseEvent(&view_reader, &view) || !view.done()) {
+        std::cerr << "-- The view has more events.\n";
+        return 1;
+    }
+
+    std::cout << "-- " << num_eve << " events viewed.\n";
+}
@@ -0,0 +1,71 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#include <iostream>
+#include <random>
+#include "lhco/lhco.h"
+#include "lhco/writer.h"
+#include "test_writer.h"
+
+// The halfway cases of the rounding in the fixed notation of LHCO.
+RandomNumber randomNumber() {
+    return RandomNumber(
+        {0.0005, 0.0015, -0.0025, 0.005, 0.125, 2.675, 1e-300, 1e300}, -5, 5);
+}
+
+bool checkRandomEvents() {
+    std::mt19937_64 gen(20260102);
+    std::uniform_int_distribution<int> integer(-1000000, 1000000);
+    std::uniform_int_distribution<int> typ(0, 6);
+    std::uniform_int_distribution<int> nobj(1, 20);
+    RandomNumber number = randomNumber();
+    auto rnd = [&gen, &number] { return number(&gen); };
+
+    for (int ieve = 0; ieve < 2000; ++ieve) {
+        lhco::Objects objs;
+        for (int i = nobj(gen); i > 0; --i) {
+            objs.push_back(lhco::Object(typ(gen), rnd(), rnd(), rnd(), rnd(),
+                                        integer(gen), integer(gen), rnd()));
+        }
+        const lhco::RawEvent ev{lhco::Header{integer(gen), integer(gen)},
+                                objs};
+        if (!sameOutput<lhco::Writer>(ev)) { return false; }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    lhco::Header header{4, 3587};
+
+    lhco::Objects objs;
+    objs.push_back(
+        lhco::Object(2, 0.271, 3.641, 270.63, 0.11, -1.0, 3.0, 5.01));
+    objs.push_back(
+        lhco::Object(4, -0.136, 0.290, 440.15, 79.66, 19.0, 0.0, 1.23));
+    objs.push_back(
+        lhco::Object(4, 0.671, 3.309, 91.96, 23.46, 14.0, 2.0, 2.36));
+    objs.push_back(lhco::Object(4, 0.422, 3.019, 99.76, 3.97, 12.0, 2.0, 1.87));
+    objs.push_back(lhco::Object(4, -1.419, 1.018, 23.75, 1.79, 5.0, 0.0, 4.17));
+    objs.push_back(lhco::Object(6, 0.000, 3.688, 20.20, 0.00, 0.0, 0.0, 0.00));
+
+    lhco::RawEvent ev{header, objs};
+    {
+        // The output must be the same as that of `test_render_lhco`.
+        lhco::Writer writer(&std::cout);
+        writer << "-- Rendering LHCO Event ...\n";
+        writer << ev << '\n';
+        writer << "-- Rendering done.\n";
+    }
+
+    // An integer is not written as a character.
+    if (!sameOutput<lhco::Writer>(42) || !sameOutput<lhco::Writer>(-7)) {
+        return 1;
+    }
+    if (!checkRandomEvents()) { return 1; }
+    if (argc == 2 &&
+        !checkFile<lhco::Writer, lhco::RawEvent>(
+            argv[1], [](std::istream *is, lhco::RawEvent *ev) {
+                return lhco::parseRawEvent(is, ev);
+            })) {
+        return 1;
+    }
+}
@@ -0,0 +1,90 @@
+/* Copyright (c) 2026, Chan Beom Park <cbpark@gmail.com> */
+
+#ifndef COLEVENT_SRC_TEST_WRITER_H_
+#define COLEVENT_SRC_TEST_WRITER_H_
+
+// The comparison of `lhef::Writer` and `lhco::Writer` with `operator<<`,
+// shared by test_write_lhef and test_write_lhco.
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+template <typename T>
+std::string byStream(const T &x) {
+    std::ostringstream os;
+    os << x;
+    return os.str();
+}
+
+// A small buffer, so that the writer flushes in the middle of the output.
+template <typename Writer, typename T>
+std::string byWriter(const T &x) {
+    std::ostringstream os;
+    {
+        Writer writer(&os, 64);
+        writer << x;
+    }
+    return os.str();
+}
+
+template <typename Writer, typename T>
+bool sameOutput(const T &x) {
+    const std::string expected = byStream(x), written = byWriter<Writer>(x);
+    if (expected == written) { return true; }
+    std::cerr << "-- Output differs:\n" << expected << '\n' << written << '\n';
+    return false;
+}
+
+// Numbers of magnitudes from 1e`min_exponent` to 1e`max_exponent`, mixed with
+// zeros, the extremes, infinities, NaNs and the values in `specials`, e.g.,
+// the halfway cases of the rounding in the notation of the format.
+class RandomNumber {
+private:
+    std::vector<double> specials_;
+    std::uniform_int_distribution<std::size_t> pick_;
+    std::uniform_real_distribution<double> mantissa_{-10.0, 10.0};
+    std::uniform_int_distribution<int> exponent_;
+
+public:
+    RandomNumber(std::vector<double> specials, int min_exponent,
+                 int max_exponent)
+        : specials_(std::move(specials)),
+          exponent_(min_exponent, max_exponent) {
+        using limits = std::numeric_limits<double>;
+        specials_.insert(specials_.end(),
+                         {0.0, -0.0, limits::max(), limits::min(),
+                          limits::denorm_min(), limits::infinity(),
+                          -limits::infinity(), limits::quiet_NaN()});
+        pick_ = std::uniform_int_distribution<std::size_t>(
+            0, 4 * specials_.size());
+    }
+
+    double operator()(std::mt19937_64 *gen) {
+        const std::size_t i = pick_(*gen);
+        if (i < specials_.size()) { return specials_[i]; }
+        return mantissa_(*gen) * std::pow(10.0, exponent_(*gen));
+    }
+};
+
+// Compares the output of every event read from the file by `parse(&fin, &ev)`.
+template <typename Writer, typename Event, typename Parse>
+bool checkFile(const char *fname, Parse parse) {
+    std::ifstream fin(fname);
+    if (!fin) {
+        std::cerr << "-- Cannot open input file \"" << fname << "\".\n";
+        return false;
+    }
+    for (Event ev; parse(&fin, &ev);) {
+        if (!sameOutput<Writer>(ev)) { return false; }
+    }
+    return true;
+}
+
+#endif  // COLEVENT_SRC_TEST_WRITER_H_